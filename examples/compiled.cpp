@@ -0,0 +1,301 @@
+/**
+  * @file compiled.cpp
+  *
+  * @brief Checks compiled evaluation against direct evaluation.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#include <cmath>
+#include <iostream>
+#include <fmt/core.h>
+#include <symbolic/symbolic.h>
+
+
+static bool IsClose(double left, double right)
+{
+    return std::abs(left - right) <= 1e-6 * (1.0 + std::abs(right));
+}
+
+
+// Binds the arguments of compiled to argValues.
+static Frame MakeFrame(
+    const Compiled &compiled,
+    const std::vector<double> &argValues)
+{
+    Frame frame;
+
+    for (size_t i = 0; i < argValues.size(); ++i)
+    {
+        frame = frame.With(*compiled.GetArgs()[i], argValues[i]);
+    }
+
+    return frame;
+}
+
+
+// The sum of the outputs, evaluated directly rather than compiled.
+static double SumOutputs(const std::vector<S> &outputs, const Frame &frame)
+{
+    double result = 0.0;
+
+    for (const auto &output: outputs)
+    {
+        result += Evaluate(output, frame);
+    }
+
+    return result;
+}
+
+
+// Compares the reverse-mode gradient with central differences.
+static int CheckGradient(
+    const std::vector<S> &outputs,
+    const std::vector<double> &argValues)
+{
+    static constexpr double step = 1e-6;
+
+    Compiled compiled(outputs);
+    auto gradient = compiled.EvaluateGradient(argValues).gradient;
+    int failures = 0;
+
+    for (size_t i = 0; i < argValues.size(); ++i)
+    {
+        auto above = argValues;
+        auto below = argValues;
+        above[i] += step;
+        below[i] -= step;
+
+        auto expected =
+            (SumOutputs(outputs, MakeFrame(compiled, above))
+                - SumOutputs(outputs, MakeFrame(compiled, below)))
+            / (2.0 * step);
+
+        fmt::print(
+            "d/d{}: reverse {:10.6f}, differences {:10.6f}\n",
+            *compiled.GetArgs()[i],
+            gradient[i],
+            expected);
+
+        if (!IsClose(gradient[i], expected))
+        {
+            ++failures;
+        }
+    }
+
+    return failures;
+}
+
+
+// Compares dual-number derivatives along directions with central
+// differences, for a batch of bindings.
+static int CheckDirectional(
+    const std::vector<S> &outputs,
+    const std::vector<std::vector<double>> &argValues,
+    const std::vector<std::vector<double>> &directions)
+{
+    static constexpr double step = 1e-6;
+
+    Compiled compiled(outputs);
+    auto directional = compiled.EvaluateDirectional(argValues, directions);
+    int failures = 0;
+
+    size_t bindingCount = argValues.front().size();
+
+    for (size_t binding = 0; binding < bindingCount; ++binding)
+    {
+        std::vector<double> above;
+        std::vector<double> below;
+
+        for (size_t i = 0; i < argValues.size(); ++i)
+        {
+            above.push_back(
+                argValues[i][binding] + step * directions[i][binding]);
+
+            below.push_back(
+                argValues[i][binding] - step * directions[i][binding]);
+        }
+
+        auto aboveFrame = MakeFrame(compiled, above);
+        auto belowFrame = MakeFrame(compiled, below);
+
+        for (size_t output = 0; output < outputs.size(); ++output)
+        {
+            auto derivative = directional.derivatives[output][binding];
+
+            auto expected =
+                (Evaluate(outputs[output], aboveFrame)
+                    - Evaluate(outputs[output], belowFrame)) / (2.0 * step);
+
+            fmt::print(
+                "binding {}, output {}: dual {:10.6f}, differences {:10.6f}\n",
+                binding,
+                output,
+                derivative,
+                expected);
+
+            if (!IsClose(derivative, expected))
+            {
+                ++failures;
+            }
+        }
+    }
+
+    return failures;
+}
+
+
+// Compares a product graph with direct evaluation of the symbolic product,
+// before and after changing the argument of one factor.
+static int CheckProductGraph()
+{
+    auto p = S("p");
+    auto q = S("q");
+    auto r = S("r");
+
+    std::vector<Matrix> factors(3, Matrix(2, 2));
+
+    factors[0](0, 0) = 3 * p;
+    factors[0](0, 1) = -5 * q;
+    factors[0](1, 0) = S(7) / 2;
+    factors[0](1, 1) = 4 * (p^2);
+
+    factors[1](0, 0) = 2 * S("cos", "q");
+    factors[1](0, 1) = -3 * S("sin", "q");
+    factors[1](1, 0) = 6 * S("sin", "q");
+    factors[1](1, 1) = 9 * S("cos", "q");
+
+    factors[2](0, 0) = -11 * r;
+    factors[2](0, 1) = 13 * p * r;
+    factors[2](1, 0) = (r^3) / 5;
+    factors[2](1, 1) = S(8);
+
+    auto product = factors[0].Multiply(factors[1]).Multiply(factors[2]);
+
+    ProductGraph graph(factors);
+    int failures = 0;
+
+    auto check = [&]()
+    {
+        Frame frame{
+            {Arg::Get("p"), *Arg::Get("p")->GetValue()},
+            {Arg::Get("q"), *Arg::Get("q")->GetValue()},
+            {Arg::Get("r"), *Arg::Get("r")->GetValue()}};
+
+        const auto &values = graph.Evaluate();
+
+        for (size_t column = 0; column < 2; ++column)
+        {
+            for (size_t row = 0; row < 2; ++row)
+            {
+                auto value = values[column * 2 + row];
+                auto expected = Evaluate(product(row, column), frame);
+
+                fmt::print(
+                    "({}, {}): graph {:12.6f}, direct {:12.6f}\n",
+                    row,
+                    column,
+                    value,
+                    expected);
+
+                if (!IsClose(value, expected))
+                {
+                    ++failures;
+                }
+            }
+        }
+    };
+
+    Arg::Get("p")->SetValue(0.6);
+    Arg::Get("q")->SetValue(-1.3);
+    Arg::Get("r")->SetValue(1.7);
+    check();
+
+    Arg::Get("r")->SetValue(-0.4);
+    check();
+
+    return failures;
+}
+
+
+int main()
+{
+    auto x = S("x");
+    auto y = S("y");
+    auto z = S("z");
+
+    // Each scalar and power is a new symbol, so these outputs exercise the
+    // compiler's memo of visited symbols.
+    std::vector<S> outputs{
+        2 * x,
+        3 * y,
+        5 * z,
+        x^3,
+        -7 * x * y + S("sin", "x") * 4,
+        (x^2) * 6 - 11 * z / 3,
+        9 * S("cos", "y") * S("cos", "y") + x * z * 13};
+
+    Compiled compiled(outputs);
+
+    std::vector<double> argValues{0.3, -0.7, 1.9};
+
+    Frame frame{
+        {Arg::Get("x"), argValues[0]},
+        {Arg::Get("y"), argValues[1]},
+        {Arg::Get("z"), argValues[2]}};
+
+    auto values = compiled.Evaluate(argValues);
+    int failures = 0;
+
+    for (size_t i = 0; i < outputs.size(); ++i)
+    {
+        auto expected = Evaluate(outputs[i], frame);
+
+        fmt::print(
+            "{:>2}: compiled {:10.6f}, direct {:10.6f}\n",
+            i,
+            values[i],
+            expected);
+
+        if (!IsClose(values[i], expected))
+        {
+            ++failures;
+        }
+    }
+
+    std::cout << "\nGradient of the outputs:\n";
+    failures += CheckGradient(outputs, argValues);
+
+    auto sinX = S("sin", "x");
+    auto cosX = S("cos", "x");
+    auto cosY = S("cos", "y");
+
+    std::vector<S> trig{
+        sinX * cosY + 3 * cosX * cosX,
+        2 * sinX * (cosY^3)};
+
+    std::cout << "\nGradient of the trig outputs at (0.3, -0.7):\n";
+    failures += CheckGradient(trig, {0.3, -0.7});
+
+    std::cout << "\nDirectional derivatives of the outputs:\n";
+
+    failures += CheckDirectional(
+        outputs,
+        {{0.3, -1.1}, {-0.7, 0.4}, {1.9, 2.5}},
+        {{1.0, 0.5}, {0.0, -2.0}, {0.0, 1.5}});
+
+    std::cout << "\nProduct graph of three factors:\n";
+    failures += CheckProductGraph();
+
+    if (failures)
+    {
+        fmt::print("{} checks failed.\n", failures);
+
+        return 1;
+    }
+
+    return 0;
+}
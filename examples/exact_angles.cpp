@@ -0,0 +1,58 @@
+/**
+  * @file exact_angles.cpp
+  *
+  * @brief Compares exact angles with values bound by SetValue.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#include <iostream>
+#include <cmath>
+#include <symbolic/symbolic.h>
+
+
+Matrix MakeRotation(const std::string &angle)
+{
+    Matrix result(2, 2);
+
+    result.Assign(
+        S{"cos", angle}, -1 * S{"sin", angle},
+        S{"sin", angle}, S{"cos", angle});
+
+    return result;
+}
+
+
+void Print(const std::string &angle)
+{
+    auto point = S{"cos", angle} * S("x") + S{"sin", angle} * S("y");
+    auto rotation = MakeRotation(angle);
+
+    std::cout << "cos(" << angle << ") * x + sin(" << angle << ") * y:\n";
+    std::cout << point << "\n\n";
+
+    std::cout << "R(" << angle << ") * R(" << angle << "):\n";
+    std::cout << rotation * rotation << std::endl;
+}
+
+
+int main()
+{
+    // A double is only close to π / 2, so trig functions of it are not
+    // exact, and the symbols are printed as they are.
+    Arg::Get("b")->SetValue(M_PI / 2.0);
+
+    std::cout << "With b bound by SetValue(π / 2):\n\n";
+    Print("b");
+
+    // An exact angle folds trig functions of common angles to their values.
+    Arg::Get("b")->SetPiMultiple(1, 2);
+
+    std::cout << "\nWith b bound by SetPiMultiple(1, 2):\n\n";
+    Print("b");
+
+    return 0;
+}
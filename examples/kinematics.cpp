@@ -0,0 +1,70 @@
+/**
+  * @file kinematics.cpp
+  *
+  * @brief Forward kinematics of a six joint arm.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#include <iostream>
+#include <fmt/core.h>
+#include <symbolic/symbolic.h>
+
+
+int main()
+{
+    // The Denavit-Hartenberg parameters of a PUMA 560, with symbolic link
+    // lengths and offsets.
+    KinematicChain chain({
+        {"θ1", S(0), S(0), Angle::QuarterTurns(1)},
+        {"θ2", S(0), S("a2"), Angle::QuarterTurns(0)},
+        {"θ3", S("d3"), S("a3"), Angle::QuarterTurns(-1)},
+        {"θ4", S("d4"), S(0), Angle::QuarterTurns(1)},
+        {"θ5", S(0), S(0), Angle::QuarterTurns(-1)},
+        {"θ6", S(0), S(0), Angle::QuarterTurns(0)}});
+
+    settings::printCompact = true;
+
+    std::cout << "Wrist center (frame 4):\n";
+    std::cout << chain.GetFrame(4).GetTranslation() << std::endl;
+
+    auto compiled = chain.Compile();
+
+    fmt::print(
+        "End effector compiled to {} instructions.\n\n",
+        compiled.GetNodes().size());
+
+    std::vector<double> jointAngles{0.1, -0.4, 0.7, 1.2, -0.3, 0.5};
+
+    for (size_t joint = 0; joint < jointAngles.size(); ++joint)
+    {
+        Arg::Get(fmt::format("θ{}", joint + 1))->SetValue(jointAngles[joint]);
+    }
+
+    // Lengths in meters.
+    Arg::Get("a2")->SetValue(0.4318);
+    Arg::Get("d3")->SetValue(0.1501);
+    Arg::Get("a3")->SetValue(0.0203);
+    Arg::Get("d4")->SetValue(0.4318);
+
+    auto elements = compiled.Evaluate();
+
+    std::cout << "End effector:\n";
+
+    for (size_t row = 0; row < 3; ++row)
+    {
+        fmt::print(
+            "[ {:8.5f} {:8.5f} {:8.5f} {:8.5f} ]\n",
+            elements[row],
+            elements[3 + row],
+            elements[6 + row],
+            elements[9 + row]);
+    }
+
+    fmt::print("[ {:8.5f} {:8.5f} {:8.5f} {:8.5f} ]\n", 0.0, 0.0, 0.0, 1.0);
+
+    return 0;
+}
@@ -0,0 +1,270 @@
+/**
+  * @file parallel.cpp
+  *
+  * @brief Checks parallel computations against their serial counterparts.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#include <array>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <fmt/core.h>
+#include <symbolic/symbolic.h>
+#include <symbolic/angle_sums.h>
+
+
+// Results must not depend on the count of threads, so each check runs on
+// pools of each of these sizes. A pool without threads runs every task on
+// the calling thread.
+static constexpr std::array<size_t, 4> threadCounts{0, 1, 3, 7};
+
+
+template<typename T>
+static std::string ToString(const T &value)
+{
+    std::ostringstream output;
+    output << value;
+
+    return output.str();
+}
+
+
+// Compares the printed results, which differ when the terms of any
+// element are ordered or grouped differently.
+template<typename Compute>
+static int Check(
+    const std::string &name,
+    const std::string &expected,
+    Compute &&compute)
+{
+    int failures = 0;
+
+    for (auto threadCount: threadCounts)
+    {
+        ThreadPool pool(threadCount);
+        bool isSame = (ToString(compute(pool)) == expected);
+
+        fmt::print(
+            "{}, {} threads: {}\n",
+            name,
+            threadCount,
+            isSame ? "same" : "DIFFERS");
+
+        if (!isSame)
+        {
+            ++failures;
+        }
+    }
+
+    return failures;
+}
+
+
+static Matrix MakeRotation(const std::string &angle)
+{
+    auto c = S("cos", angle);
+    auto s = S("sin", angle);
+
+    Matrix result(3, 3);
+
+    result.Assign(
+        c, -1 * s, 0,
+        s, c, 0,
+        0, 0, 1);
+
+    return result;
+}
+
+
+static Matrix MakePlanarRotation(const std::string &angle)
+{
+    auto c = S("cos", angle);
+    auto s = S("sin", angle);
+
+    Matrix result(2, 2);
+    result.Assign(c, -1 * s, s, c);
+
+    return result;
+}
+
+
+static Matrix MakeGeneral(const std::string &prefix)
+{
+    Matrix result(3, 3);
+
+    for (size_t row = 0; row < 3; ++row)
+    {
+        for (size_t column = 0; column < 3; ++column)
+        {
+            result(row, column) =
+                S(fmt::format("{}{}{}", prefix, row, column));
+        }
+    }
+
+    return result;
+}
+
+
+// Enough terms to span several of the blocks that ParallelSum hashes on
+// separate tasks, with many like terms among them.
+static std::vector<S> MakeTerms()
+{
+    static constexpr size_t count = 3000;
+
+    std::array<std::string, 6> names{"a", "b", "c", "d", "e", "f"};
+    std::vector<S> result;
+    result.reserve(count);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        S term(static_cast<int>(i % 7) - 3);
+        term = term * S(names[i % names.size()]);
+
+        if (i % 3 == 0)
+        {
+            term = term * S("sin", names[(i / 3) % names.size()]);
+        }
+
+        if (i % 5 == 0)
+        {
+            term = term * S(names[(i / 5) % names.size()]);
+        }
+
+        result.push_back(term);
+    }
+
+    return result;
+}
+
+
+// (1 + a + b + ... + f)^power, which has many terms that several chunks
+// of the product share.
+static Polynomial MakePolynomial(int power)
+{
+    Polynomial result(Value(1));
+
+    for (auto name: {"a", "b", "c", "d", "e", "f"})
+    {
+        result = result + Polynomial(SymbolName(name), 1);
+    }
+
+    return result.Power(power);
+}
+
+
+// Products of planar rotations about pairs of angles, side by side, so
+// that the elements need the identities of several angle sums.
+static Matrix MakeRotationProducts()
+{
+    static constexpr size_t angleCount = 4;
+
+    Matrix result(2, 2 * angleCount * (angleCount - 1));
+    size_t offset = 0;
+
+    for (size_t i = 0; i < angleCount; ++i)
+    {
+        for (size_t j = 0; j < angleCount; ++j)
+        {
+            if (i == j)
+            {
+                continue;
+            }
+
+            auto product = MakePlanarRotation(fmt::format("q{}", i))
+                .Multiply(MakePlanarRotation(fmt::format("q{}", j)));
+
+            for (size_t row = 0; row < 2; ++row)
+            {
+                for (size_t column = 0; column < 2; ++column)
+                {
+                    result(row, offset + column) = product(row, column);
+                }
+            }
+
+            offset += 2;
+        }
+    }
+
+    return result;
+}
+
+
+int main()
+{
+    int failures = 0;
+
+    auto left = MakeGeneral("a");
+    auto right = MakeRotation("q");
+
+    failures += Check(
+        "Matrix product",
+        ToString(left.Multiply(right)),
+        [&left, &right](ThreadPool &pool)
+        {
+            return left.Multiply(right, pool);
+        });
+
+    auto chain =
+        MakeRotation("q0") * MakeGeneral("b") * MakeRotation("q1") * left;
+
+    failures += Check(
+        "Matrix chain",
+        ToString(chain.Evaluate()),
+        [&chain](ThreadPool &pool)
+        {
+            // A copy starts without computed elements, so that every
+            // element is computed on the pool.
+            MatrixChain copy = chain;
+
+            return copy.Evaluate(pool);
+        });
+
+    auto terms = MakeTerms();
+
+    failures += Check(
+        "Sum",
+        ToString(Sum(terms)),
+        [&terms](ThreadPool &pool)
+        {
+            return ParallelSum(terms, pool);
+        });
+
+    auto polynomial = MakePolynomial(4);
+    auto other = MakePolynomial(3);
+
+    failures += Check(
+        "Polynomial product",
+        ToString(polynomial * other),
+        [&polynomial, &other](ThreadPool &pool)
+        {
+            return polynomial.Multiply(other, pool);
+        });
+
+    auto rotations = MakeRotationProducts();
+    ThreadPool serial(0);
+    AngleSumCache serialCache;
+
+    failures += Check(
+        "Angle sums",
+        ToString(ReplaceAngleSums(rotations, serialCache, serial)),
+        [&rotations](ThreadPool &pool)
+        {
+            AngleSumCache cache;
+
+            return ReplaceAngleSums(rotations, cache, pool);
+        });
+
+    if (failures)
+    {
+        fmt::print("{} checks failed.\n", failures);
+
+        return 1;
+    }
+
+    return 0;
+}
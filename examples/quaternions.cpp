@@ -0,0 +1,35 @@
+/**
+  * @file quaternions.cpp
+  *
+  * @brief Composes intrinsic rotations as quaternions.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#include <iostream>
+#include <symbolic/symbolic.h>
+
+
+using namespace greek;
+
+
+int main()
+{
+    auto rotation =
+        Quaternion::AboutZ(small::gamma)
+        * Quaternion::AboutY(small::beta)
+        * Quaternion::AboutX(small::alpha);
+
+    std::cout << "R(γ) * R(β) * R(α) as a quaternion:\n";
+    std::cout << rotation << std::endl;
+
+    settings::printCompact = true;
+
+    std::cout << "\nAs a matrix:\n";
+    std::cout << rotation.ToMatrix() << std::endl;
+
+    return 0;
+}
@@ -14,7 +14,6 @@
 #include <symbolic/greek.h>
 #include <symbolic/angle_sums.h>
 #include <fmt/core.h>
-#include <tau/angles.h>
 
 
 using namespace greek;
@@ -62,25 +61,26 @@ void PrintRotation(
 
     fmt::print("\n{:*^79}\n", product);
 
-    std::cout << first.matrix * second.matrix * third.matrix << std::endl;
+    // The product is computed once, and specialized for each angle.
+    Specializer specializer(first.matrix * second.matrix * third.matrix);
+    std::cout << specializer.GetMatrix() << std::endl;
 
     std::cout << "\nSetting " << *second.arg << " to pi/2" << std::endl;
-    second.arg->SetValue(tau::Angles<double>::pi / 2);
-    auto matrix1 = first.matrix * second.matrix * third.matrix;
+    const Matrix &matrix1 =
+        specializer(Bindings().BindAngle(*second.arg, 1, 2));
+
     std::cout << matrix1 << std::endl;
     std::cout << "\nUsing angle sum/difference identities" << std::endl;
     std::cout << ReplaceAngleSums(matrix1) << std::endl;
 
     std::cout << "\nSetting " << *second.arg << " to -pi/2" << std::endl;
-    second.arg->SetValue(-tau::Angles<double>::pi / 2);
+    const Matrix &matrix2 =
+        specializer(Bindings().BindAngle(*second.arg, -1, 2));
 
-    auto matrix2 = first.matrix * second.matrix * third.matrix;
     std::cout << matrix2 << std::endl;
 
     std::cout << "\nUsing angle sum/difference identities" << std::endl;
     std::cout << ReplaceAngleSums(matrix2) << std::endl;
-
-    second.arg->ClearValue();
 }
 
 
@@ -101,6 +101,8 @@ int main()
         0, cosAlpha, -1 * sinAlpha,
         0, sinAlpha, cosAlpha);
 
+    alpha.matrix.SetOrthogonality(Orthogonality::rotation);
+
     auto sinBeta = S{sin, small::beta};
     auto cosBeta = S{cos, small::beta};
 
@@ -109,6 +111,8 @@ int main()
         0, 1, 0,
         -1 * sinBeta, 0, cosBeta);
 
+    beta.matrix.SetOrthogonality(Orthogonality::rotation);
+
     auto sinGamma = S{sin, small::gamma};
     auto cosGamma = S{cos, small::gamma};
 
@@ -117,6 +121,8 @@ int main()
         sinGamma, cosGamma, 0,
         0, 0, 1);
 
+    gamma.matrix.SetOrthogonality(Orthogonality::rotation);
+
     alpha.Print();
     beta.Print();
     gamma.Print();
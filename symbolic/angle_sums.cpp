@@ -68,26 +68,42 @@ std::ostream & operator<<(
 }
 
 
-void CheckIdentity(Symbol::Pointer &element, const Identity &identity)
+AngleSumCache::AngleSumCache()
+    :
+    identities_()
 {
-    if (element->Equals(identity.expression))
-    {
-        element = identity.name;
-    }
-    else if ((element * -1)->Equals(identity.expression))
-    {
-        element = identity.name * -1;
-    }
+
+}
+
+
+const SumAndDifference & AngleSumCache::Get(
+    const std::shared_ptr<Arg> &first,
+    const std::shared_ptr<Arg> &second)
+{
+    Key key(first.get(), second.get());
+
+    auto identity =
+        this->identities_.try_emplace(key, *first, *second).first;
+
+    return identity->second;
 }
 
 
-void ReplaceElement(Matrix &matrix, size_t row, size_t column)
+size_t AngleSumCache::GetSize() const
 {
-    auto &element = matrix(row, column);
+    return this->identities_.size();
+}
 
+
+using Angles = std::pair<std::shared_ptr<Arg>, std::shared_ptr<Arg>>;
+
+
+// The angles of an element that could be a sum or difference identity.
+static std::optional<Angles> GetAngles(const Symbol::Pointer &element)
+{
     if (!element->IsExpression())
     {
-        return;
+        return {};
     }
 
     auto expression =
@@ -97,12 +113,12 @@ void ReplaceElement(Matrix &matrix, size_t row, size_t column)
 
     if (!expression->IsTrig())
     {
-        return;
+        return {};
     }
 
     if (!expression->GetLeft()->IsExpression())
     {
-        return;
+        return {};
     }
 
     auto left =
@@ -116,29 +132,93 @@ void ReplaceElement(Matrix &matrix, size_t row, size_t column)
 
     if (!leftNamed || !rightNamed)
     {
-        return;
+        return {};
     }
 
-    SumAndDifference sums(
-        *leftNamed->GetArg(),
-        *rightNamed->GetArg());
+    return Angles(leftNamed->GetArg(), rightNamed->GetArg());
+}
+
+
+// The name of the identity that element expands, or nullptr.
+static Symbol::Pointer ReplaceElement(
+    const Symbol::Pointer &element,
+    const SumAndDifference &sums)
+{
+    const Identity *candidates[] =
+    {
+        &sums.sinSum,
+        &sums.cosSum,
+        &sums.sinDifference,
+        &sums.cosDifference
+    };
+
+    auto negated = element * -1;
+
+    for (const auto *identity: candidates)
+    {
+        if (element->Equals(identity->expression))
+        {
+            return identity->name;
+        }
+
+        if (negated->Equals(identity->expression))
+        {
+            return identity->name * -1;
+        }
+    }
 
-    CheckIdentity(element, sums.sinSum);
-    CheckIdentity(element, sums.cosSum);
-    CheckIdentity(element, sums.sinDifference);
-    CheckIdentity(element, sums.cosDifference);
+    return {};
 }
 
 
 Matrix ReplaceAngleSums(const Matrix &matrix)
 {
+    AngleSumCache cache;
+
+    return ReplaceAngleSums(matrix, cache, ThreadPool::GetDefault());
+}
+
+
+Matrix ReplaceAngleSums(
+    const Matrix &matrix,
+    AngleSumCache &cache,
+    ThreadPool &pool)
+{
+    size_t rows = matrix.GetRowCount();
+    size_t count = rows * matrix.GetColumnCount();
+
+    std::vector<const SumAndDifference *> identities(count, nullptr);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        auto angles = GetAngles(matrix(i % rows, i / rows));
+
+        if (angles)
+        {
+            identities[i] = &cache.Get(angles->first, angles->second);
+        }
+    }
+
+    std::vector<Symbol::Pointer> replaced(count);
+
+    pool.ForEach(
+        count,
+        [&matrix, &identities, &replaced, rows](size_t i)
+        {
+            if (identities[i])
+            {
+                replaced[i] =
+                    ReplaceElement(matrix(i % rows, i / rows), *identities[i]);
+            }
+        });
+
     Matrix result = matrix;
 
-    for (size_t column = 0; column < matrix.GetColumnCount(); ++column)
+    for (size_t i = 0; i < count; ++i)
     {
-        for (size_t row = 0; row < matrix.GetRowCount(); ++row)
+        if (replaced[i])
         {
-            ReplaceElement(result, row, column);
+            result(i % rows, i / rows) = replaced[i];
         }
     }
 
@@ -1,7 +1,10 @@
 #pragma once
 
 
+#include <map>
+#include <memory>
 #include <ostream>
+#include <utility>
 #include <fmt/core.h>
 #include "symbolic/symbolic.h"
 
@@ -29,4 +32,40 @@ struct SumAndDifference
 std::ostream & operator<<(std::ostream &output, const SumAndDifference &);
 
 
+// The SumAndDifference identities of each pair of angles, built once.
+// Keep one cache for as long as its Context, to reuse the identities
+// across calls to ReplaceAngleSums.
+//
+// The cache is not synchronized. Call Get from one thread at a time, and
+// never from pool tasks, because building an identity creates arguments.
+// The identities it returns may be read from any thread.
+class AngleSumCache
+{
+public:
+    AngleSumCache();
+
+    // Builds the identities on first use, which creates the arguments
+    // "first + second" and "first - second".
+    const SumAndDifference & Get(
+        const std::shared_ptr<Arg> &first,
+        const std::shared_ptr<Arg> &second);
+
+    size_t GetSize() const;
+
+private:
+    using Key = std::pair<const Arg *, const Arg *>;
+
+    std::map<Key, SumAndDifference> identities_;
+};
+
+
 Matrix ReplaceAngleSums(const Matrix &matrix);
+
+
+// The identities that elements need are built first, on the calling
+// thread, because building them creates arguments. The elements are then
+// replaced on the threads of pool.
+Matrix ReplaceAngleSums(
+    const Matrix &matrix,
+    AngleSumCache &cache,
+    ThreadPool &pool);
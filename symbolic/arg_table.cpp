@@ -0,0 +1,117 @@
+/**
+  * @file arg_table.cpp
+  *
+  * @brief Implements the flat hash table of arguments.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#include "symbolic/arg_table.h"
+
+#include <cassert>
+#include <functional>
+
+
+static constexpr size_t initialSlotCount = 64;
+
+
+ArgTable::ArgTable()
+    :
+    slots_(initialSlotCount),
+    size_(0)
+{
+
+}
+
+
+ArgTable::Hash ArgTable::GetHash(std::string_view name)
+{
+    return std::hash<std::string_view>{}(name);
+}
+
+
+size_t ArgTable::Find(std::string_view name, Hash hash) const
+{
+    size_t mask = this->slots_.size() - 1;
+    size_t index = hash & mask;
+
+    while (true)
+    {
+        const auto &slot = this->slots_[index];
+
+        // Comparing the full hash first skips most string comparisons.
+        if (!slot.arg
+                || (slot.hash == hash && std::string_view(*slot.arg) == name))
+        {
+            return index;
+        }
+
+        index = (index + 1) & mask;
+    }
+}
+
+
+const std::shared_ptr<Arg> & ArgTable::Get(size_t slot) const
+{
+    return this->slots_[slot].arg;
+}
+
+
+void ArgTable::Insert(size_t slot, const std::shared_ptr<Arg> &arg, Hash hash)
+{
+    assert(!this->slots_[slot].arg);
+
+    // Keep the load factor at or below 1/2, so that probe sequences stay
+    // short.
+    if (2 * (this->size_ + 1) > this->slots_.size())
+    {
+        this->Grow_();
+
+        // Names are unique, so no slot in the new probe sequence holds
+        // this name.
+        slot = this->FindEmpty_(hash);
+    }
+
+    auto &target = this->slots_[slot];
+    target.hash = hash;
+    target.arg = arg;
+    ++this->size_;
+}
+
+
+size_t ArgTable::GetSize() const
+{
+    return this->size_;
+}
+
+
+size_t ArgTable::FindEmpty_(Hash hash) const
+{
+    size_t mask = this->slots_.size() - 1;
+    size_t index = hash & mask;
+
+    while (this->slots_[index].arg)
+    {
+        index = (index + 1) & mask;
+    }
+
+    return index;
+}
+
+
+void ArgTable::Grow_()
+{
+    std::vector<Slot_> previous(2 * this->slots_.size());
+    std::swap(previous, this->slots_);
+
+    for (auto &slot: previous)
+    {
+        if (slot.arg)
+        {
+            this->slots_[this->FindEmpty_(slot.hash)] = std::move(slot);
+        }
+    }
+}
@@ -0,0 +1,79 @@
+/**
+  * @file arg_table.h
+  *
+  * @brief A flat hash table of arguments by name.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#pragma once
+
+#include <memory>
+#include <string_view>
+#include <vector>
+#include "symbolic/symbol.h"
+
+
+/**
+  * Open addressing with linear probing. Arguments are looked up by
+  * std::string_view, so finding an existing argument copies nothing, and a
+  * lookup that misses returns the empty slot the argument belongs in.
+  *
+  * Arguments are never removed, so there are no tombstones.
+**/
+class ArgTable
+{
+public:
+    using Hash = size_t;
+
+    ArgTable();
+
+    static Hash GetHash(std::string_view name);
+
+    // The slot holding the argument with this name, or the empty slot
+    // where it belongs. hash must be GetHash(name).
+    size_t Find(std::string_view name, Hash hash) const;
+
+    // The argument in slot, or nullptr when the slot is empty.
+    const std::shared_ptr<Arg> & Get(size_t slot) const;
+
+    // Adds an argument to the empty slot that Find returned for it, without
+    // probing again. When the table must grow first, the argument is
+    // placed in the first empty slot after its hash, which needs no string
+    // comparisons. hash must be GetHash(*arg).
+    void Insert(size_t slot, const std::shared_ptr<Arg> &arg, Hash hash);
+
+    size_t GetSize() const;
+
+    // Calls function with each argument, in no particular order.
+    template<typename Function>
+    void ForEach(Function &&function) const
+    {
+        for (const auto &slot: this->slots_)
+        {
+            if (slot.arg)
+            {
+                function(slot.arg);
+            }
+        }
+    }
+
+private:
+    struct Slot_
+    {
+        Hash hash;
+        std::shared_ptr<Arg> arg;
+    };
+
+    // The first empty slot at or after hash.
+    size_t FindEmpty_(Hash hash) const;
+
+    void Grow_();
+
+    // The count of slots is a power of two.
+    std::vector<Slot_> slots_;
+    size_t size_;
+};
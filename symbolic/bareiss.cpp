@@ -0,0 +1,210 @@
+/**
+  * @file bareiss.cpp
+  *
+  * @brief Implements fraction-free elimination.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#include "symbolic/bareiss.h"
+
+#include <stdexcept>
+#include "symbolic/polynomial.h"
+
+
+using Rows = std::vector<std::vector<Polynomial>>;
+
+
+static Rows Expand(const Matrix &matrix, const Matrix *augment)
+{
+    size_t augmentColumns = (augment) ? augment->GetColumnCount() : 0;
+
+    Rows rows(matrix.GetRowCount());
+
+    for (size_t row = 0; row < matrix.GetRowCount(); ++row)
+    {
+        auto &values = rows[row];
+        values.reserve(matrix.GetColumnCount() + augmentColumns);
+
+        for (size_t column = 0; column < matrix.GetColumnCount(); ++column)
+        {
+            values.push_back(Polynomial::FromSymbol(matrix(row, column)));
+        }
+
+        for (size_t column = 0; column < augmentColumns; ++column)
+        {
+            values.push_back(Polynomial::FromSymbol((*augment)(row, column)));
+        }
+    }
+
+    return rows;
+}
+
+
+struct Elimination
+{
+    // The upper triangle, followed by the transformed augment columns.
+    Rows rows;
+
+    // The determinant of the matrix, or zero when singular.
+    Polynomial determinant;
+};
+
+
+// Reduces rows to upper triangular form. Each new element is divided by the
+// previous pivot, which Sylvester's identity guarantees to be exact.
+static Elimination Eliminate(Rows rows)
+{
+    size_t size = rows.size();
+    size_t width = (size > 0) ? rows.front().size() : 0;
+
+    Value sign(1);
+    Polynomial previous(Value(1));
+
+    for (size_t k = 0; k < size; ++k)
+    {
+        if (rows[k][k].IsZero())
+        {
+            size_t pivot = k + 1;
+
+            while (pivot < size && rows[pivot][k].IsZero())
+            {
+                ++pivot;
+            }
+
+            if (pivot == size)
+            {
+                return {std::move(rows), Polynomial()};
+            }
+
+            std::swap(rows[k], rows[pivot]);
+            sign *= Value(-1);
+        }
+
+        for (size_t i = k + 1; i < size; ++i)
+        {
+            for (size_t j = k + 1; j < width; ++j)
+            {
+                auto numerator =
+                    rows[k][k] * rows[i][j] - rows[i][k] * rows[k][j];
+
+                auto quotient = numerator.ExactDivide(previous);
+
+                if (!quotient)
+                {
+                    throw std::logic_error("Bareiss division is not exact");
+                }
+
+                rows[i][j] = std::move(*quotient);
+            }
+
+            rows[i][k] = Polynomial();
+        }
+
+        previous = rows[k][k];
+    }
+
+    if (size == 0)
+    {
+        return {std::move(rows), Polynomial(Value(1))};
+    }
+
+    // The final pivot is the determinant of the row-swapped matrix.
+    auto determinant = rows[size - 1][size - 1] * sign;
+
+    return {std::move(rows), std::move(determinant)};
+}
+
+
+static void RequireSquare(const Matrix &matrix)
+{
+    if (matrix.GetRowCount() != matrix.GetColumnCount())
+    {
+        throw std::runtime_error("Matrix must be square");
+    }
+}
+
+
+S BareissDeterminant(const Matrix &matrix)
+{
+    RequireSquare(matrix);
+
+    return Eliminate(Expand(matrix, nullptr)).determinant.ToSymbol();
+}
+
+
+Matrix BareissSolve(const Matrix &matrix, const Matrix &b)
+{
+    RequireSquare(matrix);
+
+    if (b.GetRowCount() != matrix.GetRowCount())
+    {
+        throw std::runtime_error("Incompatible dimensions");
+    }
+
+    size_t size = matrix.GetRowCount();
+
+    if (size == 0)
+    {
+        return Matrix(0, b.GetColumnCount());
+    }
+
+    auto elimination = Eliminate(Expand(matrix, &b));
+
+    if (elimination.determinant.IsZero())
+    {
+        throw std::runtime_error("Matrix is singular");
+    }
+
+    auto &rows = elimination.rows;
+
+    // The last pivot, without the sign of the row swaps.
+    // The swaps were applied to b as well, so the solution is unchanged.
+    const auto &pivot = rows[size - 1][size - 1];
+
+    Matrix result(size, b.GetColumnCount());
+
+    for (size_t column = 0; column < b.GetColumnCount(); ++column)
+    {
+        // Back substitution for pivot * x, which has no fractions.
+        std::vector<Polynomial> scaled(size);
+
+        for (size_t i = size; i-- > 0;)
+        {
+            auto numerator = pivot * rows[i][size + column];
+
+            for (size_t j = i + 1; j < size; ++j)
+            {
+                numerator = numerator - rows[i][j] * scaled[j];
+            }
+
+            auto quotient = numerator.ExactDivide(rows[i][i]);
+
+            if (!quotient)
+            {
+                throw std::logic_error("Back substitution is not exact");
+            }
+
+            scaled[i] = std::move(*quotient);
+        }
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            auto quotient = scaled[i].ExactDivide(pivot);
+
+            if (quotient)
+            {
+                result(i, column) = quotient->ToSymbol();
+            }
+            else
+            {
+                result(i, column) = scaled[i].ToSymbol() / pivot.ToSymbol();
+            }
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,30 @@
+/**
+  * @file bareiss.h
+  *
+  * @brief Fraction-free elimination of symbolic matrices.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#pragma once
+
+#include "symbolic/matrix.h"
+
+
+/**
+  * Bareiss elimination expands each element to a Polynomial, and divides
+  * every step by the previous pivot. The division is always exact, so the
+  * intermediate elements grow linearly instead of exponentially.
+  *
+  * Elements must expand to polynomials (no negative or fractional powers).
+  * Otherwise, std::runtime_error is thrown.
+**/
+S BareissDeterminant(const Matrix &matrix);
+
+
+// Solves matrix * x = b for x.
+// Throws std::runtime_error when matrix is singular.
+Matrix BareissSolve(const Matrix &matrix, const Matrix &b);
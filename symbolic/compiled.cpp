@@ -0,0 +1,788 @@
+/**
+  * @file compiled.cpp
+  *
+  * @brief Implements compiled numeric evaluation.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#include "symbolic/compiled.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+#include <tuple>
+#include "symbolic/expression.h"
+#include "symbolic/named.h"
+#include "symbolic/value.h"
+
+
+using Pointer = typename Symbol::Pointer;
+using Instruction = typename Compiled::Instruction;
+using Node = typename Compiled::Node;
+
+
+static std::shared_ptr<Arg> GetRoot(std::shared_ptr<Arg> arg)
+{
+    while (arg->GetParent())
+    {
+        arg = arg->GetParent();
+    }
+
+    return arg;
+}
+
+
+void CollectArgs(
+    const Symbol::Pointer &symbol,
+    std::vector<std::shared_ptr<Arg>> &args)
+{
+    if (symbol->IsNamed())
+    {
+        auto named = dynamic_cast<const Named *>(symbol.get());
+        assert(named);
+
+        auto arg = GetRoot(named->GetArg());
+
+        if (std::find(std::begin(args), std::end(args), arg) == std::end(args))
+        {
+            args.push_back(arg);
+        }
+
+        return;
+    }
+
+    auto expression = dynamic_cast<const Expression *>(symbol.get());
+
+    if (!expression)
+    {
+        return;
+    }
+
+    CollectArgs(expression->GetScalar(), args);
+    CollectArgs(expression->GetLeft(), args);
+    CollectArgs(expression->GetRight(), args);
+    CollectArgs(expression->GetPower(), args);
+}
+
+
+class Compiled::Builder_
+{
+public:
+    Builder_(
+        std::vector<Node> &nodes,
+        const std::vector<std::shared_ptr<Arg>> &args)
+        :
+        nodes_(nodes),
+        args_(args),
+        index_(),
+        visited_()
+    {
+
+    }
+
+    size_t Add(const Pointer &symbol)
+    {
+        auto found = this->visited_.find(symbol.get());
+
+        if (found != std::end(this->visited_))
+        {
+            return found->second.second;
+        }
+
+        size_t result;
+
+        if (symbol->IsValue())
+        {
+            auto value = dynamic_cast<const Value *>(symbol.get());
+            assert(value);
+
+            result = this->Constant_(value->GetValue<double>());
+        }
+        else if (symbol->IsNamed())
+        {
+            auto named = dynamic_cast<const Named *>(symbol.get());
+            assert(named);
+
+            result = this->Argument_(named->GetArg());
+
+            const auto &symbolName = named->GetSymbolName();
+
+            if (symbolName.IsTrig())
+            {
+                result = this->Emit_(
+                    Instruction::function,
+                    result,
+                    static_cast<size_t>(symbolName.GetFunction()),
+                    0.0);
+            }
+
+            result = this->Raise_(result, named->GetPower());
+            result = this->Scale_(result, named->GetScalar());
+        }
+        else
+        {
+            auto expression = dynamic_cast<const Expression *>(symbol.get());
+
+            if (!expression)
+            {
+                throw std::runtime_error("Unsupported symbol");
+            }
+
+            auto left = this->Add(expression->GetLeft());
+            auto right = this->Add(expression->GetRight());
+
+            result = this->Emit_(
+                GetInstruction(expression->GetOp()),
+                left,
+                right,
+                0.0);
+
+            result = this->Raise_(result, expression->GetPower());
+            result = this->Scale_(result, expression->GetScalar());
+        }
+
+        this->visited_.emplace(symbol.get(), std::make_pair(symbol, result));
+
+        return result;
+    }
+
+private:
+    static Instruction GetInstruction(Op op)
+    {
+        switch (op)
+        {
+            case Op::add:
+                return Instruction::add;
+
+            case Op::subtract:
+                return Instruction::subtract;
+
+            case Op::multiply:
+                return Instruction::multiply;
+
+            case Op::divide:
+                return Instruction::divide;
+
+            default:
+                throw std::logic_error("Invalid operator");
+        }
+    }
+
+    size_t Emit_(
+        Instruction instruction,
+        size_t left,
+        size_t right,
+        double constant)
+    {
+        if (instruction == Instruction::add
+                || instruction == Instruction::multiply)
+        {
+            // Commutative operands are ordered to find more matches.
+            if (left > right)
+            {
+                std::swap(left, right);
+            }
+        }
+
+        auto key = std::make_tuple(instruction, left, right, constant);
+        auto found = this->index_.find(key);
+
+        if (found != std::end(this->index_))
+        {
+            return found->second;
+        }
+
+        size_t result = this->nodes_.size();
+        this->nodes_.push_back(Node{instruction, left, right, constant});
+        this->index_.emplace(key, result);
+
+        return result;
+    }
+
+    size_t Constant_(double value)
+    {
+        return this->Emit_(Instruction::constant, 0, 0, value);
+    }
+
+    size_t Argument_(const std::shared_ptr<Arg> &arg)
+    {
+        auto root = GetRoot(arg);
+
+        auto found = std::find(
+            std::begin(this->args_),
+            std::end(this->args_),
+            root);
+
+        if (found == std::end(this->args_))
+        {
+            throw std::runtime_error("Argument is not listed: " + *root);
+        }
+
+        auto result = this->Emit_(
+            Instruction::argument,
+            static_cast<size_t>(std::distance(std::begin(this->args_), found)),
+            0,
+            0.0);
+
+        if (arg != root)
+        {
+            // Fractional arguments are scaled from the root.
+            double scale = 1.0;
+
+            for (auto child = arg; child != root; child = child->GetParent())
+            {
+                scale /= child->GetDivisor();
+            }
+
+            result = this->Emit_(
+                Instruction::multiply,
+                this->Constant_(scale),
+                result,
+                0.0);
+        }
+
+        return result;
+    }
+
+    size_t Scale_(size_t node, const Pointer &scalar)
+    {
+        if (scalar->IsOne())
+        {
+            return node;
+        }
+
+        return this->Emit_(
+            Instruction::multiply,
+            this->Add(scalar),
+            node,
+            0.0);
+    }
+
+    size_t Raise_(size_t node, const Pointer &power)
+    {
+        if (power->IsOne())
+        {
+            return node;
+        }
+
+        auto value = dynamic_cast<const Value *>(power.get());
+
+        if (value)
+        {
+            double exponent = value->GetValue<double>();
+
+            if (exponent == 2.0)
+            {
+                return this->Emit_(Instruction::multiply, node, node, 0.0);
+            }
+
+            if (exponent == -1.0)
+            {
+                return this->Emit_(
+                    Instruction::divide,
+                    this->Constant_(1.0),
+                    node,
+                    0.0);
+            }
+        }
+
+        return this->Emit_(Instruction::power, node, this->Add(power), 0.0);
+    }
+
+    std::vector<Node> &nodes_;
+    const std::vector<std::shared_ptr<Arg>> &args_;
+
+    std::map<std::tuple<Instruction, size_t, size_t, double>, size_t> index_;
+
+    // Scalars and powers of named symbols are created on each access, so
+    // the visited symbols are held to keep their addresses from being
+    // reused while the builder runs.
+    std::map<const Symbol *, std::pair<Pointer, size_t>> visited_;
+};
+
+
+static std::vector<std::shared_ptr<Arg>> CollectAllArgs(
+    const std::vector<S> &outputs)
+{
+    std::vector<std::shared_ptr<Arg>> args;
+
+    for (const auto &output: outputs)
+    {
+        CollectArgs(output, args);
+    }
+
+    return args;
+}
+
+
+static std::vector<S> GetElements(const Matrix &matrix)
+{
+    std::vector<S> elements;
+    elements.reserve(matrix.GetRowCount() * matrix.GetColumnCount());
+
+    for (size_t column = 0; column < matrix.GetColumnCount(); ++column)
+    {
+        for (size_t row = 0; row < matrix.GetRowCount(); ++row)
+        {
+            elements.push_back(matrix(row, column));
+        }
+    }
+
+    return elements;
+}
+
+
+Compiled::Compiled(const std::vector<S> &outputs)
+    :
+    Compiled(outputs, CollectAllArgs(outputs))
+{
+
+}
+
+
+Compiled::Compiled(
+    const std::vector<S> &outputs,
+    const std::vector<std::shared_ptr<Arg>> &args)
+    :
+    args_(args),
+    nodes_(),
+    outputs_()
+{
+    Builder_ builder(this->nodes_, this->args_);
+
+    this->outputs_.reserve(outputs.size());
+
+    for (const auto &output: outputs)
+    {
+        this->outputs_.push_back(builder.Add(output));
+    }
+}
+
+
+Compiled::Compiled(const Matrix &matrix)
+    :
+    Compiled(GetElements(matrix))
+{
+
+}
+
+
+const std::vector<std::shared_ptr<Arg>> & Compiled::GetArgs() const
+{
+    return this->args_;
+}
+
+
+const std::vector<Node> & Compiled::GetNodes() const
+{
+    return this->nodes_;
+}
+
+
+size_t Compiled::GetOutputCount() const
+{
+    return this->outputs_.size();
+}
+
+
+std::vector<double> Compiled::Evaluate(
+    const std::vector<double> &argValues) const
+{
+    auto values = this->Forward_(argValues);
+
+    std::vector<double> result;
+    result.reserve(this->outputs_.size());
+
+    for (auto output: this->outputs_)
+    {
+        result.push_back(values[output]);
+    }
+
+    return result;
+}
+
+
+std::vector<double> Compiled::Evaluate() const
+{
+    std::vector<double> argValues;
+    argValues.reserve(this->args_.size());
+
+    for (const auto &arg: this->args_)
+    {
+        auto value = arg->GetValue();
+
+        if (!value)
+        {
+            throw std::runtime_error("Argument has no value: " + *arg);
+        }
+
+        argValues.push_back(*value);
+    }
+
+    return this->Evaluate(argValues);
+}
+
+
+std::vector<double> Compiled::Evaluate(const Frame &frame) const
+{
+    std::vector<double> argValues;
+    argValues.reserve(this->args_.size());
+
+    for (const auto &arg: this->args_)
+    {
+        auto value = frame.GetValue(*arg);
+
+        if (!value)
+        {
+            throw std::runtime_error("Argument has no value: " + *arg);
+        }
+
+        argValues.push_back(*value);
+    }
+
+    return this->Evaluate(argValues);
+}
+
+
+Compiled::Gradient Compiled::EvaluateGradient(
+    const std::vector<double> &argValues,
+    const std::vector<double> &weights) const
+{
+    if (weights.size() != this->outputs_.size())
+    {
+        throw std::runtime_error("Unexpected weight count");
+    }
+
+    auto values = this->Forward_(argValues);
+
+    Gradient result{{}, std::vector<double>(this->args_.size(), 0.0)};
+    result.values.reserve(this->outputs_.size());
+
+    std::vector<double> adjoints(this->nodes_.size(), 0.0);
+
+    for (size_t i = 0; i < this->outputs_.size(); ++i)
+    {
+        result.values.push_back(values[this->outputs_[i]]);
+        adjoints[this->outputs_[i]] += weights[i];
+    }
+
+    // Every instruction reads only earlier instructions, so one pass in
+    // reverse order completes each adjoint before it is used.
+    for (size_t i = this->nodes_.size(); i-- > 0;)
+    {
+        double adjoint = adjoints[i];
+
+        if (adjoint == 0.0)
+        {
+            continue;
+        }
+
+        const auto &node = this->nodes_[i];
+
+        switch (node.instruction)
+        {
+            case Instruction::constant:
+                break;
+
+            case Instruction::argument:
+                result.gradient[node.left] += adjoint;
+                break;
+
+            case Instruction::function:
+                adjoints[node.left] +=
+                    adjoint
+                    * GetTrigInfo(static_cast<Trig>(node.right))
+                        .derivative(values[node.left]);
+
+                break;
+
+            case Instruction::add:
+                adjoints[node.left] += adjoint;
+                adjoints[node.right] += adjoint;
+                break;
+
+            case Instruction::subtract:
+                adjoints[node.left] += adjoint;
+                adjoints[node.right] -= adjoint;
+                break;
+
+            case Instruction::multiply:
+                adjoints[node.left] += adjoint * values[node.right];
+                adjoints[node.right] += adjoint * values[node.left];
+                break;
+
+            case Instruction::divide:
+            {
+                double right = values[node.right];
+
+                adjoints[node.left] += adjoint / right;
+
+                adjoints[node.right] -=
+                    adjoint * values[node.left] / (right * right);
+
+                break;
+            }
+
+            case Instruction::power:
+            {
+                double base = values[node.left];
+                double exponent = values[node.right];
+
+                adjoints[node.left] +=
+                    adjoint * exponent * std::pow(base, exponent - 1.0);
+
+                if (base > 0.0)
+                {
+                    adjoints[node.right] +=
+                        adjoint * std::log(base) * values[i];
+                }
+
+                break;
+            }
+
+            default:
+                throw std::logic_error("Invalid instruction");
+        }
+    }
+
+    return result;
+}
+
+
+Compiled::Gradient Compiled::EvaluateGradient(
+    const std::vector<double> &argValues) const
+{
+    return this->EvaluateGradient(
+        argValues,
+        std::vector<double>(this->outputs_.size(), 1.0));
+}
+
+
+Compiled::Directional Compiled::EvaluateDirectional(
+    const std::vector<std::vector<double>> &argValues,
+    const std::vector<std::vector<double>> &directions) const
+{
+    if (argValues.size() != this->args_.size()
+            || directions.size() != this->args_.size())
+    {
+        throw std::runtime_error("Unexpected argument count");
+    }
+
+    size_t batch = argValues.empty() ? 1 : argValues.front().size();
+
+    for (size_t arg = 0; arg < this->args_.size(); ++arg)
+    {
+        if (argValues[arg].size() != batch || directions[arg].size() != batch)
+        {
+            throw std::runtime_error("Unexpected batch size");
+        }
+    }
+
+    // The value and tangent of node i, binding b, are at i * batch + b.
+    std::vector<double> values(this->nodes_.size() * batch);
+    std::vector<double> tangents(this->nodes_.size() * batch);
+
+    for (size_t i = 0; i < this->nodes_.size(); ++i)
+    {
+        const auto &node = this->nodes_[i];
+
+        double *value = &values[i * batch];
+        double *tangent = &tangents[i * batch];
+
+        const double *left = nullptr;
+        const double *leftTangent = nullptr;
+        const double *right = nullptr;
+        const double *rightTangent = nullptr;
+
+        // Only these operands are indices of nodes.
+        if (node.instruction != Instruction::constant
+                && node.instruction != Instruction::argument)
+        {
+            left = &values[node.left * batch];
+            leftTangent = &tangents[node.left * batch];
+
+            if (node.instruction != Instruction::function)
+            {
+                right = &values[node.right * batch];
+                rightTangent = &tangents[node.right * batch];
+            }
+        }
+
+        switch (node.instruction)
+        {
+            case Instruction::constant:
+                std::fill(value, value + batch, node.constant);
+                std::fill(tangent, tangent + batch, 0.0);
+                break;
+
+            case Instruction::argument:
+                std::copy_n(argValues[node.left].data(), batch, value);
+                std::copy_n(directions[node.left].data(), batch, tangent);
+                break;
+
+            case Instruction::function:
+            {
+                const auto &function =
+                    GetTrigInfo(static_cast<Trig>(node.right));
+
+                for (size_t b = 0; b < batch; ++b)
+                {
+                    value[b] = function.evaluate(left[b]);
+                    tangent[b] = function.derivative(left[b]) * leftTangent[b];
+                }
+
+                break;
+            }
+
+            case Instruction::add:
+                for (size_t b = 0; b < batch; ++b)
+                {
+                    value[b] = left[b] + right[b];
+                    tangent[b] = leftTangent[b] + rightTangent[b];
+                }
+
+                break;
+
+            case Instruction::subtract:
+                for (size_t b = 0; b < batch; ++b)
+                {
+                    value[b] = left[b] - right[b];
+                    tangent[b] = leftTangent[b] - rightTangent[b];
+                }
+
+                break;
+
+            case Instruction::multiply:
+                for (size_t b = 0; b < batch; ++b)
+                {
+                    value[b] = left[b] * right[b];
+
+                    tangent[b] =
+                        leftTangent[b] * right[b] + left[b] * rightTangent[b];
+                }
+
+                break;
+
+            case Instruction::divide:
+                for (size_t b = 0; b < batch; ++b)
+                {
+                    value[b] = left[b] / right[b];
+
+                    tangent[b] =
+                        (leftTangent[b] * right[b] - left[b] * rightTangent[b])
+                        / (right[b] * right[b]);
+                }
+
+                break;
+
+            case Instruction::power:
+                for (size_t b = 0; b < batch; ++b)
+                {
+                    value[b] = std::pow(left[b], right[b]);
+
+                    tangent[b] =
+                        right[b]
+                        * std::pow(left[b], right[b] - 1.0)
+                        * leftTangent[b];
+
+                    if (left[b] > 0.0)
+                    {
+                        tangent[b] +=
+                            std::log(left[b]) * value[b] * rightTangent[b];
+                    }
+                }
+
+                break;
+
+            default:
+                throw std::logic_error("Invalid instruction");
+        }
+    }
+
+    Directional result;
+    result.values.reserve(this->outputs_.size());
+    result.derivatives.reserve(this->outputs_.size());
+
+    auto count = static_cast<std::ptrdiff_t>(batch);
+
+    for (auto output: this->outputs_)
+    {
+        auto offset = static_cast<std::ptrdiff_t>(output * batch);
+        auto first = std::next(std::begin(values), offset);
+        auto firstTangent = std::next(std::begin(tangents), offset);
+
+        result.values.emplace_back(first, std::next(first, count));
+
+        result.derivatives.emplace_back(
+            firstTangent,
+            std::next(firstTangent, count));
+    }
+
+    return result;
+}
+
+
+std::vector<double> Compiled::Forward_(
+    const std::vector<double> &argValues) const
+{
+    if (argValues.size() != this->args_.size())
+    {
+        throw std::runtime_error("Unexpected argument count");
+    }
+
+    std::vector<double> values(this->nodes_.size());
+
+    for (size_t i = 0; i < this->nodes_.size(); ++i)
+    {
+        const auto &node = this->nodes_[i];
+
+        switch (node.instruction)
+        {
+            case Instruction::constant:
+                values[i] = node.constant;
+                break;
+
+            case Instruction::argument:
+                values[i] = argValues[node.left];
+                break;
+
+            case Instruction::function:
+                values[i] = GetTrigInfo(static_cast<Trig>(node.right))
+                    .evaluate(values[node.left]);
+                break;
+
+            case Instruction::add:
+                values[i] = values[node.left] + values[node.right];
+                break;
+
+            case Instruction::subtract:
+                values[i] = values[node.left] - values[node.right];
+                break;
+
+            case Instruction::multiply:
+                values[i] = values[node.left] * values[node.right];
+                break;
+
+            case Instruction::divide:
+                values[i] = values[node.left] / values[node.right];
+                break;
+
+            case Instruction::power:
+                values[i] = std::pow(values[node.left], values[node.right]);
+                break;
+
+            default:
+                throw std::logic_error("Invalid instruction");
+        }
+    }
+
+    return values;
+}
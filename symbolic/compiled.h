@@ -0,0 +1,137 @@
+/**
+  * @file compiled.h
+  *
+  * @brief Compiles symbols to a flat program for fast numeric evaluation.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "symbolic/symbol.h"
+#include "symbolic/matrix.h"
+#include "symbolic/frame.h"
+
+
+// Appends the arguments used by symbol that are not already in args, in
+// order of appearance. A fractional argument contributes its parent.
+void CollectArgs(
+    const Symbol::Pointer &symbol,
+    std::vector<std::shared_ptr<Arg>> &args);
+
+
+/**
+  * The outputs are translated once into a list of instructions, each
+  * reading the results of earlier instructions. Identical subexpressions,
+  * within one output or across outputs, become a single instruction, so
+  * each is computed once per evaluation.
+  *
+  * Evaluation walks the list without touching the symbols, so it is much
+  * faster than evaluating the symbols themselves.
+**/
+class Compiled
+{
+public:
+    enum class Instruction
+    {
+        constant,
+        argument,
+        function,
+        add,
+        subtract,
+        multiply,
+        divide,
+        power
+    };
+
+    struct Node
+    {
+        Instruction instruction;
+
+        // The operands, as indices of earlier nodes.
+        // An argument node stores the index of its argument in left, and a
+        // function node stores the index of its function in right.
+        size_t left;
+        size_t right;
+
+        double constant;
+    };
+
+    // Arguments are ordered by their appearance in outputs.
+    explicit Compiled(const std::vector<S> &outputs);
+
+    // Arguments are ordered as given. Throws std::runtime_error when an
+    // output uses an argument that is not listed.
+    Compiled(
+        const std::vector<S> &outputs,
+        const std::vector<std::shared_ptr<Arg>> &args);
+
+    // The outputs are the elements of matrix, in column-major order.
+    explicit Compiled(const Matrix &matrix);
+
+    const std::vector<std::shared_ptr<Arg>> & GetArgs() const;
+
+    const std::vector<Node> & GetNodes() const;
+
+    size_t GetOutputCount() const;
+
+    // argValues are in the order of GetArgs().
+    std::vector<double> Evaluate(const std::vector<double> &argValues) const;
+
+    // Evaluates with the values set on each Arg.
+    // Throws std::runtime_error when an argument has no value.
+    std::vector<double> Evaluate() const;
+
+    // Evaluates with the values in frame. Any number of threads may
+    // evaluate at once.
+    // Throws std::runtime_error when an argument has no value.
+    std::vector<double> Evaluate(const Frame &frame) const;
+
+    struct Gradient
+    {
+        std::vector<double> values;
+
+        // In the order of GetArgs().
+        std::vector<double> gradient;
+    };
+
+    // Reverse-mode differentiation: one backward sweep over the instructions
+    // gives the gradient of the sum of weights[i] * output i with respect to
+    // every argument. Memory is one value and one adjoint per instruction.
+    Gradient EvaluateGradient(
+        const std::vector<double> &argValues,
+        const std::vector<double> &weights) const;
+
+    // The gradient of the sum of the outputs.
+    Gradient EvaluateGradient(const std::vector<double> &argValues) const;
+
+    // Indexed [output][binding].
+    struct Directional
+    {
+        std::vector<std::vector<double>> values;
+        std::vector<std::vector<double>> derivatives;
+    };
+
+    // Forward-mode differentiation with dual numbers: each output and its
+    // derivative along a direction, in one pass. argValues and directions
+    // are indexed [arg][binding], and every binding of the batch is
+    // computed by the same instruction before moving to the next, over
+    // contiguous arrays that the compiler can vectorize.
+    Directional EvaluateDirectional(
+        const std::vector<std::vector<double>> &argValues,
+        const std::vector<std::vector<double>> &directions) const;
+
+private:
+    std::vector<double> Forward_(const std::vector<double> &argValues) const;
+
+    class Builder_;
+
+    std::vector<std::shared_ptr<Arg>> args_;
+    std::vector<Node> nodes_;
+    std::vector<size_t> outputs_;
+};
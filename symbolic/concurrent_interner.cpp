@@ -0,0 +1,75 @@
+/**
+  * @file concurrent_interner.cpp
+  *
+  * @brief Implements sharing of symbols across threads.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#include "symbolic/concurrent_interner.h"
+
+
+using Pointer = typename Symbol::Pointer;
+
+
+ConcurrentInterner::ConcurrentInterner()
+    :
+    shards_()
+{
+
+}
+
+
+size_t ConcurrentInterner::GetSize() const
+{
+    size_t result = 0;
+
+    for (const auto &shard: this->shards_)
+    {
+        std::lock_guard lock(shard.mutex);
+        result += shard.table.size();
+    }
+
+    return result;
+}
+
+
+Pointer ConcurrentInterner::Find_(const Pointer &symbol)
+{
+    auto hash = symbol->Hash();
+    auto &shard = this->shards_[MixHash(hash, shardBits_)];
+
+    std::lock_guard lock(shard.mutex);
+
+    auto [first, last] = shard.table.equal_range(hash);
+
+    for (auto item = first; item != last; ++item)
+    {
+        if (item->second == symbol || item->second->Equals(symbol))
+        {
+            return item->second;
+        }
+    }
+
+    shard.table.emplace(hash, symbol);
+
+    return symbol;
+}
+
+
+ConcurrentInterner::Local::Local(ConcurrentInterner &interner)
+    :
+    InternMemo(),
+    interner_(interner)
+{
+
+}
+
+
+Pointer ConcurrentInterner::Local::Find_(const Pointer &symbol)
+{
+    return this->interner_.Find_(symbol);
+}
@@ -0,0 +1,77 @@
+/**
+  * @file concurrent_interner.h
+  *
+  * @brief Shares structurally equal symbols built on several threads.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#pragma once
+
+#include <array>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "symbolic/interner.h"
+#include "symbolic/symbol.h"
+
+
+/**
+  * The canonical nodes of a ConcurrentInterner are split into shards by
+  * hash, each with its own lock, so threads interning different nodes
+  * rarely wait on each other.
+  *
+  * Each thread interns through its own Local, which remembers the nodes
+  * that thread has already visited (as Interner does). Revisiting a node,
+  * which is most of the work for expressions with shared subexpressions,
+  * touches no shared state at all. Only a node the thread has not seen
+  * before takes the lock of one shard.
+  *
+  * Results are canonical across threads: structurally equal symbols
+  * interned through any Local of the same ConcurrentInterner are the same
+  * node.
+**/
+class ConcurrentInterner
+{
+public:
+    ConcurrentInterner();
+
+    ConcurrentInterner(const ConcurrentInterner &) = delete;
+
+    ConcurrentInterner & operator=(const ConcurrentInterner &) = delete;
+
+    // The count of canonical nodes.
+    size_t GetSize() const;
+
+    // The per-thread state of a ConcurrentInterner.
+    // A Local must only be used by one thread at a time.
+    class Local: public InternMemo
+    {
+    public:
+        explicit Local(ConcurrentInterner &interner);
+
+    private:
+        Symbol::Pointer Find_(const Symbol::Pointer &symbol) override;
+
+        ConcurrentInterner &interner_;
+    };
+
+private:
+    Symbol::Pointer Find_(const Symbol::Pointer &symbol);
+
+    static constexpr size_t shardBits_ = 6;
+
+    // Aligned so that neighboring shards do not share a cache line.
+    struct alignas(64) Shard_
+    {
+        mutable std::mutex mutex;
+
+        // Canonical nodes by hash.
+        std::unordered_multimap<size_t, Symbol::Pointer> table;
+    };
+
+    std::array<Shard_, size_t{1} << shardBits_> shards_;
+};
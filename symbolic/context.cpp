@@ -0,0 +1,142 @@
+/**
+  * @file context.cpp
+  *
+  * @brief Implements symbol contexts.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#include "symbolic/context.h"
+
+#include <stdexcept>
+
+
+// The Context of each thread, or nullptr for the default.
+static thread_local Context *currentContext = nullptr;
+
+
+Context::Context()
+    :
+    args_(),
+    concurrentInterner_()
+{
+
+}
+
+
+std::shared_ptr<Arg> Context::GetArg(std::string_view name)
+{
+    auto hash = ArgTable::GetHash(name);
+    auto slot = this->args_.Find(name, hash);
+    const auto &found = this->args_.Get(slot);
+
+    if (found)
+    {
+        return found;
+    }
+
+    auto arg = Arg::CreateShared_(std::string(name), this->GetNextId_());
+    this->args_.Insert(slot, arg, hash);
+
+    return arg;
+}
+
+
+std::shared_ptr<Arg> Context::GetFraction(std::string_view parent, int divisor)
+{
+    if (divisor < 1)
+    {
+        throw std::runtime_error("Divisor must be positive");
+    }
+
+    if (divisor == 1)
+    {
+        return this->GetArg(parent);
+    }
+
+    auto name = std::string(parent) + "/" + std::to_string(divisor);
+    auto parentArg = this->GetArg(parent);
+    auto hash = ArgTable::GetHash(name);
+    auto slot = this->args_.Find(name, hash);
+    const auto &found = this->args_.Get(slot);
+
+    if (found)
+    {
+        if (found->parent_ != parentArg || found->divisor_ != divisor)
+        {
+            throw std::runtime_error(name + " is already a different argument");
+        }
+
+        return found;
+    }
+
+    auto arg =
+        Arg::CreateShared_(name, this->GetNextId_(), parentArg, divisor);
+    this->args_.Insert(slot, arg, hash);
+
+    return arg;
+}
+
+
+size_t Context::GetArgCount() const
+{
+    return this->args_.GetSize();
+}
+
+
+void Context::UpdateDerived()
+{
+    this->args_.ForEach(
+        [](const std::shared_ptr<Arg> &arg)
+        {
+            arg->UpdateDerived_();
+        });
+}
+
+
+uint32_t Context::GetNextId_() const
+{
+    return static_cast<uint32_t>(this->args_.GetSize());
+}
+
+
+ConcurrentInterner & Context::GetConcurrentInterner()
+{
+    return this->concurrentInterner_;
+}
+
+
+Context & Context::GetDefault()
+{
+    static Context context;
+
+    return context;
+}
+
+
+Context & Context::GetCurrent()
+{
+    if (currentContext)
+    {
+        return *currentContext;
+    }
+
+    return GetDefault();
+}
+
+
+Context::Scope::Scope(Context &context)
+    :
+    previous_(currentContext)
+{
+    currentContext = &context;
+}
+
+
+Context::Scope::~Scope()
+{
+    currentContext = this->previous_;
+}
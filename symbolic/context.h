@@ -0,0 +1,95 @@
+/**
+  * @file context.h
+  *
+  * @brief Owns the arguments and interned symbols of one session.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#pragma once
+
+#include <memory>
+#include <string_view>
+#include "symbolic/symbol.h"
+#include "symbolic/arg_table.h"
+#include "symbolic/concurrent_interner.h"
+
+
+/**
+  * A Context owns a symbol table of Args (and so their values) and a
+  * ConcurrentInterner. Arg::Get and everything built on it (S, SymbolName)
+  * use the current Context of the calling thread, which is the default
+  * Context unless a Scope selects another one. Symbols share ownership of
+  * their Args, so they remain valid after their Context is destroyed.
+  *
+  * A Context is not synchronized. Sessions on different threads stay
+  * independent by each using its own Context, and need no locks. Symbols
+  * from different Contexts must not be mixed: their arguments are
+  * different objects, even when they have the same names.
+  *
+  * Several threads may build expressions in the same Context when every
+  * argument they use was created beforehand and UpdateDerived was called
+  * after the last change of a value, because then neither looking up nor
+  * reading an argument modifies anything. They share nodes through the
+  * ConcurrentInterner, which is synchronized.
+  *
+  * Single-threaded work, such as Matrix::Jacobian, interns through its
+  * own Interner instead, so that the nodes it holds are released when the
+  * work is done.
+**/
+class Context
+{
+public:
+    Context();
+
+    Context(const Context &) = delete;
+
+    Context & operator=(const Context &) = delete;
+
+    std::shared_ptr<Arg> GetArg(std::string_view name);
+
+    // Gets the argument parent/divisor, such as the half angle "α/2".
+    std::shared_ptr<Arg> GetFraction(std::string_view parent, int divisor);
+
+    // Arguments are numbered from zero in order of creation.
+    size_t GetArgCount() const;
+
+    // Brings the cached derived values (trig values, exact values) of
+    // every argument up to date. Until a value changes again, reading
+    // argument values writes nothing, so any count of threads may read
+    // them at once. ThreadPool::ForEach calls this before its tasks start.
+    void UpdateDerived();
+
+    ConcurrentInterner & GetConcurrentInterner();
+
+    // The Context used by threads without a Scope.
+    static Context & GetDefault();
+
+    // The Context selected by the innermost Scope of this thread.
+    static Context & GetCurrent();
+
+    // Makes a Context current on this thread for the lifetime of the Scope.
+    class Scope
+    {
+    public:
+        explicit Scope(Context &context);
+
+        ~Scope();
+
+        Scope(const Scope &) = delete;
+
+        Scope & operator=(const Scope &) = delete;
+
+    private:
+        Context *previous_;
+    };
+
+private:
+    uint32_t GetNextId_() const;
+
+    ArgTable args_;
+    ConcurrentInterner concurrentInterner_;
+};
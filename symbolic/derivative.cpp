@@ -0,0 +1,369 @@
+/**
+  * @file derivative.cpp
+  *
+  * @brief Implements symbolic differentiation.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#include "symbolic/derivative.h"
+
+#include <cassert>
+#include <stdexcept>
+#include "symbolic/expression.h"
+#include "symbolic/named.h"
+#include "symbolic/value.h"
+
+
+using Pointer = typename Symbol::Pointer;
+
+
+// The product, skipping structural zeros and ones.
+static S Times(const S &left, const S &right)
+{
+    auto leftStructure = GetStructure(left);
+    auto rightStructure = GetStructure(right);
+
+    if (leftStructure == Structure::zero || rightStructure == Structure::zero)
+    {
+        return S(0);
+    }
+
+    if (leftStructure == Structure::one)
+    {
+        return right;
+    }
+
+    if (rightStructure == Structure::one)
+    {
+        return left;
+    }
+
+    return left * right;
+}
+
+
+// The sum, skipping structural zeros.
+static S Plus(const S &left, const S &right)
+{
+    if (GetStructure(left) == Structure::zero)
+    {
+        return right;
+    }
+
+    if (GetStructure(right) == Structure::zero)
+    {
+        return left;
+    }
+
+    return left + right;
+}
+
+
+static S Minus(const S &left, const S &right)
+{
+    if (GetStructure(right) == Structure::zero)
+    {
+        return left;
+    }
+
+    if (GetStructure(left) == Structure::zero)
+    {
+        return S(-1) * right;
+    }
+
+    return left - right;
+}
+
+
+static const Value & GetConstantPower(const Pointer &power)
+{
+    auto value = dynamic_cast<const Value *>(power.get());
+
+    if (!value || value->HasPower())
+    {
+        throw std::runtime_error("Only constant powers can be differentiated");
+    }
+
+    return *value;
+}
+
+
+static S MakeValue(const Value &value)
+{
+    return S(std::make_shared<Value>(value));
+}
+
+
+// function(arg)^power
+static S MakeNamed(
+    Trig function,
+    const std::shared_ptr<Arg> &arg,
+    int power)
+{
+    return S(std::make_shared<Named>(
+        SymbolName(function, arg),
+        Value(1),
+        Value(power)));
+}
+
+
+// The derivative of a trig function, as a sign and a symbol.
+static std::pair<int, S> GetTrigDerivative(
+    Trig function,
+    const std::shared_ptr<Arg> &arg)
+{
+    if (function == Trig::none)
+    {
+        throw std::logic_error("Not a supported trig function");
+    }
+
+    const auto &info = GetTrigInfo(function);
+    auto [first, second] = info.derivativeFactors;
+
+    if (second == Trig::none)
+    {
+        return {info.derivativeSign, MakeNamed(first, arg, 1)};
+    }
+
+    if (first == second)
+    {
+        return {info.derivativeSign, MakeNamed(first, arg, 2)};
+    }
+
+    return {
+        info.derivativeSign,
+        MakeNamed(first, arg, 1) * MakeNamed(second, arg, 1)};
+}
+
+
+Differentiator::Differentiator(const std::shared_ptr<Arg> &arg)
+    :
+    arg_(arg),
+    memo_()
+{
+
+}
+
+
+S Differentiator::operator()(const Pointer &symbol)
+{
+    auto found = this->memo_.find(symbol.get());
+
+    if (found != std::end(this->memo_))
+    {
+        return found->second.second;
+    }
+
+    auto result = this->Differentiate_(symbol);
+    this->memo_.emplace(symbol.get(), std::make_pair(symbol, result));
+
+    return result;
+}
+
+
+const std::shared_ptr<Arg> & Differentiator::GetArg() const
+{
+    return this->arg_;
+}
+
+
+S Differentiator::Differentiate_(const Pointer &symbol)
+{
+    if (symbol->IsValue())
+    {
+        return S(0);
+    }
+
+    if (symbol->IsNamed())
+    {
+        return this->DifferentiateNamed_(symbol);
+    }
+
+    return this->DifferentiateExpression_(symbol);
+}
+
+
+S Differentiator::DifferentiateNamed_(const Pointer &symbol)
+{
+    auto named = dynamic_cast<const Named *>(symbol.get());
+    assert(named);
+
+    // d(arg)/d(this->arg_), through any fractional parents.
+    Value chain(0);
+    Value scale(1);
+
+    for (auto arg = named->GetArg(); arg; arg = arg->GetParent())
+    {
+        if (arg == this->arg_)
+        {
+            chain = scale;
+            break;
+        }
+
+        scale /= Value(arg->GetDivisor());
+    }
+
+    if (chain.IsZero())
+    {
+        return S(0);
+    }
+
+    const auto &symbolName = named->GetSymbolName();
+    auto power = GetConstantPower(named->GetPower());
+
+    // scalar * power * name^(power - 1) * name'
+    Value coefficient = power;
+    coefficient *= GetConstantPower(named->GetScalar());
+    coefficient *= chain;
+
+    auto reduced = power;
+    reduced -= Value(1);
+
+    S result(1);
+
+    if (!reduced.IsZero())
+    {
+        result = S(std::make_shared<Named>(
+            symbolName,
+            Value(1),
+            reduced));
+    }
+
+    if (symbolName.IsTrig())
+    {
+        auto [sign, derivative] = GetTrigDerivative(
+            symbolName.GetFunction(),
+            named->GetArg());
+
+        coefficient *= Value(sign);
+        result = Times(result, derivative);
+    }
+
+    return Times(MakeValue(coefficient), result);
+}
+
+
+S Differentiator::DifferentiateExpression_(const Pointer &symbol)
+{
+    auto expression = dynamic_cast<const Expression *>(symbol.get());
+
+    if (!expression)
+    {
+        throw std::runtime_error("Unsupported symbol");
+    }
+
+    auto left = S(expression->GetLeft());
+    auto right = S(expression->GetRight());
+    auto leftDerivative = (*this)(left);
+    auto rightDerivative = (*this)(right);
+
+    S inner;
+
+    switch (expression->GetOp())
+    {
+        case Op::add:
+            inner = Plus(leftDerivative, rightDerivative);
+            break;
+
+        case Op::subtract:
+            inner = Minus(leftDerivative, rightDerivative);
+            break;
+
+        case Op::multiply:
+            inner = Plus(
+                Times(leftDerivative, right),
+                Times(left, rightDerivative));
+
+            break;
+
+        case Op::divide:
+        {
+            auto numerator = Minus(
+                Times(leftDerivative, right),
+                Times(left, rightDerivative));
+
+            if (GetStructure(numerator) == Structure::zero)
+            {
+                inner = S(0);
+            }
+            else
+            {
+                inner = numerator / (right * right);
+            }
+
+            break;
+        }
+
+        default:
+            throw std::logic_error("Invalid operator");
+    }
+
+    if (GetStructure(inner) == Structure::zero)
+    {
+        return S(0);
+    }
+
+    auto power = GetConstantPower(expression->GetPower());
+
+    if (!power.IsOne())
+    {
+        // power * (left op right)^(power - 1) * inner
+        auto reduced = power;
+        reduced -= Value(1);
+
+        if (!reduced.IsZero())
+        {
+            inner = Times(
+                S(std::make_shared<Expression>(
+                    S(1),
+                    MakeValue(reduced),
+                    expression->GetOp(),
+                    left,
+                    right)),
+                inner);
+        }
+
+        inner = Times(MakeValue(power), inner);
+    }
+
+    auto scalar = S(expression->GetScalar());
+
+    if (scalar->IsValue())
+    {
+        return Times(scalar, inner);
+    }
+
+    // A symbolic scalar is one more factor of a product.
+    auto rest = S(expression->ClearScalar());
+
+    return Plus(
+        Times((*this)(scalar), rest),
+        Times(scalar, inner));
+}
+
+
+S Differentiate(const S &symbol, const std::shared_ptr<Arg> &arg)
+{
+    return Differentiator(arg)(symbol);
+}
+
+
+Matrix Differentiate(const Matrix &matrix, const std::shared_ptr<Arg> &arg)
+{
+    Differentiator differentiator(arg);
+    Matrix result(matrix.GetRowCount(), matrix.GetColumnCount());
+
+    for (size_t column = 0; column < matrix.GetColumnCount(); ++column)
+    {
+        for (size_t row = 0; row < matrix.GetRowCount(); ++row)
+        {
+            result(row, column) = differentiator(matrix(row, column));
+        }
+    }
+
+    return result;
+}
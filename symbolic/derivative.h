@@ -0,0 +1,57 @@
+/**
+  * @file derivative.h
+  *
+  * @brief Symbolic differentiation.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <utility>
+#include "symbolic/symbol.h"
+#include "symbolic/matrix.h"
+
+
+/**
+  * Differentiates with respect to one Arg. The derivative of every node is
+  * remembered, so a subexpression shared by several symbols, or by several
+  * elements of a matrix, is differentiated once. Use one Differentiator for
+  * all of the symbols that may share nodes.
+  *
+  * A fractional argument such as α/2 is differentiated by the chain rule.
+  * Powers must be constant. Otherwise, std::runtime_error is thrown.
+**/
+class Differentiator
+{
+public:
+    explicit Differentiator(const std::shared_ptr<Arg> &arg);
+
+    S operator()(const Symbol::Pointer &symbol);
+
+    const std::shared_ptr<Arg> & GetArg() const;
+
+private:
+    S Differentiate_(const Symbol::Pointer &symbol);
+
+    S DifferentiateNamed_(const Symbol::Pointer &symbol);
+
+    S DifferentiateExpression_(const Symbol::Pointer &symbol);
+
+    std::shared_ptr<Arg> arg_;
+
+    // Holds each differentiated node, so that its address is not reused.
+    std::map<const Symbol *, std::pair<Symbol::Pointer, S>> memo_;
+};
+
+
+S Differentiate(const S &symbol, const std::shared_ptr<Arg> &arg);
+
+
+// Differentiates each element.
+Matrix Differentiate(const Matrix &matrix, const std::shared_ptr<Arg> &arg);
@@ -11,6 +11,8 @@
 
 #include <iostream>
 #include <cassert>
+#include <algorithm>
+#include <iterator>
 
 #include "expression.h"
 #include "value.h"
@@ -142,8 +144,9 @@ Expression::Expression(
     scalar_(S(1)),
     power_(S(1)),
     op_(op),
-    left_(left->Copy()),
-    right_(right->Copy())
+    left_(left),
+    right_(right),
+    hash_(this->ComputeHash_())
 {
 
 }
@@ -156,11 +159,12 @@ Expression::Expression(
     Pointer left,
     Pointer right)
     :
-    scalar_(scalar->Copy()),
-    power_(power->Copy()),
+    scalar_(scalar),
+    power_(power),
     op_(op),
-    left_(left->Copy()),
-    right_(right->Copy())
+    left_(left),
+    right_(right),
+    hash_(this->ComputeHash_())
 {
 
 }
@@ -351,7 +355,11 @@ std::vector<Pointer> Expression::GetTerms(Op op) const
 {
     std::vector<Pointer> terms;
 
-    if (this->op_ != op)
+    // A power applies to the whole expression, and so does the scalar of a
+    // sum, so neither can be flattened into the terms.
+    if (this->op_ != op
+            || !this->power_->IsOne()
+            || (op != Op::multiply && !this->scalar_->IsOne()))
     {
         terms.push_back(this->Copy());
 
@@ -360,6 +368,12 @@ std::vector<Pointer> Expression::GetTerms(Op op) const
 
     // operators match
 
+    if (!this->scalar_->IsOne())
+    {
+        // The scalar of a product is one more factor.
+        terms.push_back(this->scalar_);
+    }
+
     auto left = dynamic_cast<const Expression *>(this->left_.get());
 
     if (left && left->op_ == op)
@@ -506,36 +520,45 @@ Pointer Expression::operator+(Pointer other) const
 
     auto terms = this->CollectTerms(Op::add, other);
 
-    // Collect and add like terms
     std::vector<Pointer> collectedTerms;
 
     for (const auto &items: terms)
     {
-        if (items.empty())
+        if (!items.empty())
         {
-            continue;
+            collectedTerms.push_back(AddLikeTerms(items));
         }
+    }
 
-        auto item = std::begin(items);
-        auto result = *item++;
+    return AddCollected(std::move(collectedTerms));
+}
 
-        while (item != std::end(items))
+
+Pointer Expression::AddLikeTerms(const std::vector<Pointer> &items)
+{
+    auto item = std::begin(items);
+    auto result = *item++;
+
+    while (item != std::end(items))
+    {
+        if ((*item)->IsExpression() || result->IsExpression())
         {
-            if ((*item)->IsExpression() || result->IsExpression())
-            {
-                // One or the other is an expression. xor.
-                result = Expression::Add(result, *item++);
-            }
-            else
-            {
-                // item is something that can be added to result.
-                result = result + *item++;
-            }
+            // One or the other is an expression. xor.
+            result = Expression::Add(result, *item++);
+        }
+        else
+        {
+            // item is something that can be added to result.
+            result = result + *item++;
         }
-
-        collectedTerms.push_back(result);
     }
 
+    return result;
+}
+
+
+Pointer Expression::AddCollected(std::vector<Pointer> collectedTerms)
+{
     assert(!collectedTerms.empty());
 
     // Combine the groups of like terms using Expression::Add
@@ -544,15 +567,19 @@ Pointer Expression::operator+(Pointer other) const
         return collectedTerms.front();
     }
 
-    // Sort positive terms first.
-    std::sort(
+    // Sort positive terms first, most recently collected first.
+    // A partition is used because "is not negative" is not a strict weak
+    // ordering, and std::sort may run past the end of the range with it.
+    auto firstNegative = std::stable_partition(
         std::begin(collectedTerms),
         std::end(collectedTerms),
-        [](const auto &first, const auto &)
+        [](const auto &term)
         {
-            return !first->IsNegative();
+            return !term->IsNegative();
         });
 
+    std::reverse(std::begin(collectedTerms), firstNegative);
+
     auto item = std::begin(collectedTerms);
 
     auto result = Expression::Add(*item++, *item++);
@@ -600,6 +627,9 @@ Pointer Expression::operator*(Pointer other) const
     // Collect and multiply like terms
     std::vector<Pointer> collectedTerms;
 
+    // The scalars of both operands, and any other plain values.
+    Pointer scalar = S(1);
+
     for (auto &items: terms)
     {
         if (items.empty())
@@ -631,27 +661,39 @@ Pointer Expression::operator*(Pointer other) const
             }
         }
 
+        auto value = dynamic_cast<const Value *>(result.get());
+
+        if (value && !value->HasPower())
+        {
+            scalar = scalar * result;
+            continue;
+        }
+
         collectedTerms.push_back(result);
     }
 
-    assert(!collectedTerms.empty());
+    if (collectedTerms.empty())
+    {
+        return scalar;
+    }
 
-    // Combine the groups of like terms using Expression::Add
+    // Combine the groups of like terms using Expression::Multiply
     if (collectedTerms.size() == 1)
     {
-        return collectedTerms.front();
+        return collectedTerms.front()->MultiplyScalar(scalar);
     }
 
     auto item = std::begin(collectedTerms);
 
-    auto result = Expression::Multiply(*item++, *item++);
+    auto result = Expression::Multiply(*item, *std::next(item));
+    std::advance(item, 2);
 
     while (item != std::end(collectedTerms))
     {
         result = Expression::Multiply(result, *item++);
     }
 
-    return result->MultiplyScalar(this->scalar_);
+    return result->MultiplyScalar(scalar);
 }
 
 
@@ -699,10 +741,14 @@ std::ostream & Expression::ToStream(std::ostream &output) const
 
     if (hasScalar || hasPower)
     {
-        if (this->scalar_->IsNegative())
+        if (this->scalar_->IsNegativeOne())
         {
             output << "-(";
         }
+        else if (this->scalar_->IsNegative())
+        {
+            output << "-" << this->scalar_ * -1 << "(";
+        }
         else if (!this->scalar_->IsOne())
         {
             output << this->scalar_ << "(";
@@ -772,12 +818,14 @@ std::ostream & Expression::ToStream(std::ostream &output) const
 
 Pointer Expression::Copy() const
 {
+    // Symbols are never modified after construction, so the copy shares
+    // its members.
     return std::make_shared<Expression>(
-        this->scalar_->Copy(),
-        this->power_->Copy(),
+        this->scalar_,
+        this->power_,
         this->op_,
-        this->left_->Copy(),
-        this->right_->Copy());
+        this->left_,
+        this->right_);
 }
 
 
@@ -787,8 +835,8 @@ Pointer Expression::Invert() const
         this->scalar_->Invert(),
         this->power_ * -1,
         this->op_,
-        this->left_->Copy(),
-        this->right_->Copy());
+        this->left_,
+        this->right_);
 }
 
 
@@ -823,9 +871,11 @@ bool Expression::PowersAdd(Pointer other) const
 
 bool Expression::InsideEquals_(const Expression &other) const
 {
+    // Shared members are equal without comparing their contents.
     return this->op_ == other.op_
-        && this->left_->Equals(other.left_)
-        && this->right_->Equals(other.right_);
+        && (this->left_ == other.left_ || this->left_->Equals(other.left_))
+        && (this->right_ == other.right_
+            || this->right_->Equals(other.right_));
 }
 
 
@@ -838,12 +888,34 @@ bool Expression::Equals(Pointer other) const
         return false;
     }
 
+    if (this->hash_ != otherExpression->hash_)
+    {
+        return false;
+    }
+
     return this->InsideEquals_(*otherExpression)
         && this->power_->Equals(otherExpression->power_)
         && this->scalar_->Equals(otherExpression->scalar_);
 }
 
 
+size_t Expression::Hash() const
+{
+    return this->hash_;
+}
+
+
+size_t Expression::ComputeHash_() const
+{
+    size_t result = std::hash<int>()(static_cast<int>(this->op_));
+    result = HashCombine(result, this->scalar_->Hash());
+    result = HashCombine(result, this->power_->Hash());
+    result = HashCombine(result, this->left_->Hash());
+
+    return HashCombine(result, this->right_->Hash());
+}
+
+
 bool Expression::IsOne() const
 {
     return this->power_->IsZero() && this->scalar_->IsOne();
@@ -39,12 +39,12 @@ public:
 
     Op GetOp() const override;
 
-    Pointer GetLeft()
+    Pointer GetLeft() const
     {
         return this->left_;
     }
 
-    Pointer GetRight()
+    Pointer GetRight() const
     {
         return this->right_;
     }
@@ -63,6 +63,12 @@ public:
 
     Collected CollectTerms(Op op, Pointer other) const;
 
+    // Adds a non-empty group of like terms, as collected by CollectTerms.
+    static Pointer AddLikeTerms(const std::vector<Pointer> &items);
+
+    // Joins the sums of each group of like terms, positive terms first.
+    static Pointer AddCollected(std::vector<Pointer> collectedTerms);
+
     Pointer GetScalar() const override;
 
     Pointer ClearScalar() const override;
@@ -99,6 +105,8 @@ public:
 
     bool Equals(Pointer other) const override;
 
+    size_t Hash() const override;
+
     bool IsOne() const override;
 
     bool IsZero() const override;
@@ -111,11 +119,16 @@ protected:
     bool InsideEquals_(const Expression &other) const;
 
 private:
+    size_t ComputeHash_() const;
+
     Pointer scalar_;
     Pointer power_;
     Op op_;
     Pointer left_;
     Pointer right_;
+
+    // Computed once, from the hashes of the members.
+    size_t hash_;
 };
 
 
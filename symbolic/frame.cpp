@@ -0,0 +1,145 @@
+/**
+  * @file frame.cpp
+  *
+  * @brief Implements binding frames.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#include "symbolic/frame.h"
+
+#include <cmath>
+#include <stdexcept>
+#include "symbolic/expression.h"
+#include "symbolic/named.h"
+#include "symbolic/value.h"
+
+
+Frame::Frame()
+    :
+    values_(),
+    isBound_()
+{
+
+}
+
+
+Frame::Frame(std::initializer_list<Binding> bindings)
+    :
+    Frame()
+{
+    for (const auto &[arg, value]: bindings)
+    {
+        *this = this->With(*arg, value);
+    }
+}
+
+
+Frame Frame::With(const Arg &arg, double value) const
+{
+    if (arg.GetParent())
+    {
+        throw std::logic_error("A fractional argument follows its parent");
+    }
+
+    Frame result = *this;
+    size_t id = arg.GetId();
+
+    if (id >= result.values_.size())
+    {
+        result.values_.resize(id + 1, 0.0);
+        result.isBound_.resize(id + 1, false);
+    }
+
+    result.values_[id] = value;
+    result.isBound_[id] = true;
+
+    return result;
+}
+
+
+std::optional<double> Frame::GetValue(const Arg &arg) const
+{
+    if (auto parent = arg.GetParent())
+    {
+        auto parentValue = this->GetValue(*parent);
+
+        if (!parentValue)
+        {
+            return {};
+        }
+
+        return *parentValue / arg.GetDivisor();
+    }
+
+    size_t id = arg.GetId();
+
+    if (id >= this->values_.size() || !this->isBound_[id])
+    {
+        return {};
+    }
+
+    return this->values_[id];
+}
+
+
+double Evaluate(const Symbol::Pointer &symbol, const Frame &frame)
+{
+    if (symbol->IsValue())
+    {
+        return dynamic_cast<const Value *>(symbol.get())->GetValue<double>();
+    }
+
+    if (symbol->IsNamed())
+    {
+        auto named = dynamic_cast<const Named *>(symbol.get());
+        auto value = named->GetValue<double>(frame);
+
+        if (!value)
+        {
+            throw std::runtime_error(
+                "Argument has no value: " + *named->GetArg());
+        }
+
+        return *value;
+    }
+
+    auto expression = dynamic_cast<const Expression *>(symbol.get());
+
+    if (!expression)
+    {
+        throw std::runtime_error("Unsupported symbol");
+    }
+
+    double left = Evaluate(expression->GetLeft(), frame);
+    double right = Evaluate(expression->GetRight(), frame);
+    double result;
+
+    switch (expression->GetOp())
+    {
+        case Op::add:
+            result = left + right;
+            break;
+
+        case Op::subtract:
+            result = left - right;
+            break;
+
+        case Op::multiply:
+            result = left * right;
+            break;
+
+        case Op::divide:
+            result = left / right;
+            break;
+
+        default:
+            throw std::logic_error("Invalid operator");
+    }
+
+    return Evaluate(expression->GetScalar(), frame)
+        * std::pow(result, Evaluate(expression->GetPower(), frame));
+}
@@ -0,0 +1,58 @@
+/**
+  * @file frame.h
+  *
+  * @brief Immutable argument values for one evaluation.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#pragma once
+
+#include <initializer_list>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+#include "symbolic/symbol.h"
+
+
+/**
+  * Values for some of the arguments, in a dense array indexed by
+  * Arg::GetId(). A Frame is never modified after construction, so any
+  * number of threads may evaluate with the same Frame, and with different
+  * Frames at once, without touching the values set on the Args.
+  *
+  * A fractional argument such as α/2 follows the value of its parent.
+  * Frames are only meaningful for arguments of one Context.
+**/
+class Frame
+{
+public:
+    using Binding = std::pair<std::shared_ptr<Arg>, double>;
+
+    Frame();
+
+    // Throws std::logic_error when binding a fractional argument.
+    Frame(std::initializer_list<Binding> bindings);
+
+    // A copy of this Frame, with arg bound to value.
+    Frame With(const Arg &arg, double value) const;
+
+    std::optional<double> GetValue(const Arg &arg) const;
+
+private:
+    std::vector<double> values_;
+    std::vector<bool> isBound_;
+};
+
+
+/**
+  * Evaluates symbol numerically with the values in frame.
+  * Throws std::runtime_error when an argument has no value.
+  *
+  * For many evaluations of the same symbols, prefer Compiled.
+**/
+double Evaluate(const Symbol::Pointer &symbol, const Frame &frame);
@@ -0,0 +1,114 @@
+/**
+  * @file interner.cpp
+  *
+  * @brief Implements sharing of structurally equal symbols.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#include "symbolic/interner.h"
+
+#include "symbolic/expression.h"
+
+
+using Pointer = typename Symbol::Pointer;
+
+
+InternMemo::InternMemo()
+    :
+    visited_(),
+    held_()
+{
+
+}
+
+
+InternMemo::~InternMemo()
+{
+
+}
+
+
+S InternMemo::Intern(const Pointer &symbol)
+{
+    auto visited = this->visited_.find(symbol.get());
+
+    if (visited != std::end(this->visited_))
+    {
+        return visited->second;
+    }
+
+    Pointer candidate = symbol;
+
+    auto expression = dynamic_cast<const Expression *>(symbol.get());
+
+    if (expression)
+    {
+        auto scalar = this->Intern(expression->GetScalar());
+        auto power = this->Intern(expression->GetPower());
+        auto left = this->Intern(expression->GetLeft());
+        auto right = this->Intern(expression->GetRight());
+
+        if (scalar != expression->GetScalar()
+                || power != expression->GetPower()
+                || left != expression->GetLeft()
+                || right != expression->GetRight())
+        {
+            candidate = std::make_shared<Expression>(
+                scalar,
+                power,
+                expression->GetOp(),
+                left,
+                right);
+        }
+    }
+
+    auto result = this->Find_(candidate);
+
+    this->held_.push_back(symbol);
+    this->visited_.emplace(symbol.get(), result);
+
+    if (result != symbol)
+    {
+        this->visited_.emplace(result.get(), result);
+    }
+
+    return result;
+}
+
+
+Interner::Interner()
+    :
+    InternMemo(),
+    table_()
+{
+
+}
+
+
+size_t Interner::GetSize() const
+{
+    return this->table_.size();
+}
+
+
+Pointer Interner::Find_(const Pointer &symbol)
+{
+    auto hash = symbol->Hash();
+    auto [first, last] = this->table_.equal_range(hash);
+
+    for (auto item = first; item != last; ++item)
+    {
+        if (item->second == symbol || item->second->Equals(symbol))
+        {
+            return item->second;
+        }
+    }
+
+    this->table_.emplace(hash, symbol);
+
+    return symbol;
+}
@@ -0,0 +1,66 @@
+/**
+  * @file interner.h
+  *
+  * @brief Shares structurally equal symbols.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+#include "symbolic/symbol.h"
+
+
+/**
+  * The walk shared by every interner. Intern replaces the members of an
+  * expression with their canonical nodes, rebuilding it if any changed,
+  * and asks Find_ for the canonical node of the result. Each node visited
+  * is remembered, so shared subexpressions are walked once.
+**/
+class InternMemo
+{
+public:
+    virtual ~InternMemo();
+
+    S Intern(const Symbol::Pointer &symbol);
+
+protected:
+    InternMemo();
+
+    // The canonical node equal to symbol, whose members are canonical.
+    virtual Symbol::Pointer Find_(const Symbol::Pointer &symbol) = 0;
+
+private:
+    // Every node already interned, including the canonical nodes.
+    std::unordered_map<const Symbol *, Symbol::Pointer> visited_;
+
+    // Keeps visited nodes alive, so that their addresses are not reused.
+    std::vector<Symbol::Pointer> held_;
+};
+
+
+/**
+  * Intern returns one canonical node for every set of structurally equal
+  * symbols, with canonical members all the way down. Symbols interned by
+  * the same Interner share their common subexpressions, so work memoized
+  * by node (differentiation, compilation) is done once for each of them.
+**/
+class Interner: public InternMemo
+{
+public:
+    Interner();
+
+    // The count of canonical nodes.
+    size_t GetSize() const;
+
+private:
+    Symbol::Pointer Find_(const Symbol::Pointer &symbol) override;
+
+    // Canonical nodes by hash.
+    std::unordered_multimap<size_t, Symbol::Pointer> table_;
+};
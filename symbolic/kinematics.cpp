@@ -0,0 +1,305 @@
+/**
+  * @file kinematics.cpp
+  *
+  * @brief Implements serial chain forward kinematics.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#include "symbolic/kinematics.h"
+
+#include <stdexcept>
+
+
+Angle::Angle(const std::string &arg)
+    :
+    cosine_("cos", arg),
+    sine_("sin", arg)
+{
+
+}
+
+
+Angle::Angle(const char *arg)
+    :
+    Angle(std::string(arg))
+{
+
+}
+
+
+Angle::Angle(const S &cosine, const S &sine)
+    :
+    cosine_(cosine),
+    sine_(sine)
+{
+
+}
+
+
+Angle Angle::QuarterTurns(int count)
+{
+    static const int cosines[] = {1, 0, -1, 0};
+    static const int sines[] = {0, 1, 0, -1};
+
+    int index = ((count % 4) + 4) % 4;
+
+    return Angle(S(cosines[index]), S(sines[index]));
+}
+
+
+Angle Angle::Fixed(const S &cosine, const S &sine)
+{
+    return Angle(cosine, sine);
+}
+
+
+const S & Angle::GetCosine() const
+{
+    return this->cosine_;
+}
+
+
+const S & Angle::GetSine() const
+{
+    return this->sine_;
+}
+
+
+// The product of two elements, skipping structural zeros and ones.
+static S Times(const S &left, const S &right)
+{
+    auto leftStructure = GetStructure(left);
+    auto rightStructure = GetStructure(right);
+
+    if (leftStructure == Structure::zero || rightStructure == Structure::zero)
+    {
+        return S(0);
+    }
+
+    if (leftStructure == Structure::one)
+    {
+        return right;
+    }
+
+    if (rightStructure == Structure::one)
+    {
+        return left;
+    }
+
+    return left * right;
+}
+
+
+RigidTransform::RigidTransform()
+    :
+    rotation_(Matrix::Identity(3)),
+    translation_(3, 1)
+{
+    this->translation_.Assign(0, 0, 0);
+}
+
+
+RigidTransform::RigidTransform(const Matrix &rotation, const Matrix &translation)
+    :
+    rotation_(rotation),
+    translation_(translation)
+{
+    if (rotation.GetRowCount() != 3
+            || rotation.GetColumnCount() != 3
+            || translation.GetRowCount() != 3
+            || translation.GetColumnCount() != 1)
+    {
+        throw std::runtime_error("Expected a 3x3 rotation and 3x1 translation");
+    }
+}
+
+
+RigidTransform RigidTransform::FromDenavitHartenberg(
+    const DenavitHartenberg &row)
+{
+    const auto &cosTheta = row.theta.GetCosine();
+    const auto &sinTheta = row.theta.GetSine();
+    const auto &cosAlpha = row.alpha.GetCosine();
+    const auto &sinAlpha = row.alpha.GetSine();
+
+    Matrix rotation(3, 3);
+
+    rotation.Assign(
+        cosTheta,
+        S(-1) * Times(sinTheta, cosAlpha),
+        Times(sinTheta, sinAlpha),
+
+        sinTheta,
+        Times(cosTheta, cosAlpha),
+        S(-1) * Times(cosTheta, sinAlpha),
+
+        S(0),
+        sinAlpha,
+        cosAlpha);
+
+    rotation.SetOrthogonality(Orthogonality::rotation);
+
+    Matrix translation(3, 1);
+
+    translation.Assign(
+        Times(row.a, cosTheta),
+        Times(row.a, sinTheta),
+        row.d);
+
+    return RigidTransform(rotation, translation);
+}
+
+
+RigidTransform RigidTransform::operator*(const RigidTransform &other) const
+{
+    auto rotated = this->rotation_.Multiply(other.translation_);
+
+    Matrix translation(3, 1);
+
+    for (size_t row = 0; row < 3; ++row)
+    {
+        translation(row, 0) = rotated(row, 0) + this->translation_(row, 0);
+    }
+
+    return RigidTransform(
+        this->rotation_.Multiply(other.rotation_),
+        translation);
+}
+
+
+RigidTransform RigidTransform::Inverse() const
+{
+    auto rotation = this->rotation_.Transpose();
+    auto rotated = rotation.Multiply(this->translation_);
+
+    Matrix translation(3, 1);
+
+    for (size_t row = 0; row < 3; ++row)
+    {
+        translation(row, 0) = S(-1) * rotated(row, 0);
+    }
+
+    return RigidTransform(rotation, translation);
+}
+
+
+const Matrix & RigidTransform::GetRotation() const
+{
+    return this->rotation_;
+}
+
+
+const Matrix & RigidTransform::GetTranslation() const
+{
+    return this->translation_;
+}
+
+
+Matrix RigidTransform::ToMatrix() const
+{
+    Matrix result(4, 4);
+
+    for (size_t row = 0; row < 3; ++row)
+    {
+        for (size_t column = 0; column < 3; ++column)
+        {
+            result(row, column) = this->rotation_(row, column);
+        }
+
+        result(row, 3) = this->translation_(row, 0);
+        result(3, row) = S(0);
+    }
+
+    result(3, 3) = S(1);
+
+    return result;
+}
+
+
+std::vector<S> RigidTransform::GetElements() const
+{
+    std::vector<S> elements;
+    elements.reserve(12);
+
+    for (size_t column = 0; column < 3; ++column)
+    {
+        for (size_t row = 0; row < 3; ++row)
+        {
+            elements.push_back(this->rotation_(row, column));
+        }
+    }
+
+    for (size_t row = 0; row < 3; ++row)
+    {
+        elements.push_back(this->translation_(row, 0));
+    }
+
+    return elements;
+}
+
+
+std::ostream & RigidTransform::ToStream(std::ostream &output) const
+{
+    return this->ToMatrix().ToStream(output);
+}
+
+
+std::ostream & operator<<(std::ostream &output, const RigidTransform &transform)
+{
+    return transform.ToStream(output);
+}
+
+
+KinematicChain::KinematicChain(const std::vector<DenavitHartenberg> &rows)
+    :
+    frames_{RigidTransform()},
+    args_()
+{
+    this->frames_.reserve(rows.size() + 1);
+
+    for (const auto &row: rows)
+    {
+        CollectArgs(row.theta.GetCosine(), this->args_);
+        CollectArgs(row.d, this->args_);
+        CollectArgs(row.a, this->args_);
+        CollectArgs(row.alpha.GetCosine(), this->args_);
+
+        this->frames_.push_back(
+            this->frames_.back()
+            * RigidTransform::FromDenavitHartenberg(row));
+    }
+}
+
+
+size_t KinematicChain::GetJointCount() const
+{
+    return this->frames_.size() - 1;
+}
+
+
+const RigidTransform & KinematicChain::GetFrame(size_t index) const
+{
+    return this->frames_.at(index);
+}
+
+
+const RigidTransform & KinematicChain::GetEndEffector() const
+{
+    return this->frames_.back();
+}
+
+
+const std::vector<std::shared_ptr<Arg>> & KinematicChain::GetArgs() const
+{
+    return this->args_;
+}
+
+
+Compiled KinematicChain::Compile() const
+{
+    return Compiled(this->GetEndEffector().GetElements(), this->args_);
+}
@@ -0,0 +1,131 @@
+/**
+  * @file kinematics.h
+  *
+  * @brief Forward kinematics of serial chains from Denavit-Hartenberg rows.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "symbolic/symbol.h"
+#include "symbolic/matrix.h"
+#include "symbolic/compiled.h"
+
+
+// A joint angle, or a fixed angle with known cosine and sine.
+class Angle
+{
+public:
+    Angle(const std::string &arg);
+
+    Angle(const char *arg);
+
+    // A multiple of 90 degrees, with exact cosine and sine.
+    static Angle QuarterTurns(int count);
+
+    static Angle Fixed(const S &cosine, const S &sine);
+
+    const S & GetCosine() const;
+
+    const S & GetSine() const;
+
+private:
+    Angle(const S &cosine, const S &sine);
+
+    S cosine_;
+    S sine_;
+};
+
+
+struct DenavitHartenberg
+{
+    // Rotation about the previous z axis.
+    Angle theta;
+
+    // Offset along the previous z axis.
+    S d;
+
+    // Length along the new x axis.
+    S a;
+
+    // Twist about the new x axis.
+    Angle alpha;
+};
+
+
+// A homogeneous transform stored as its blocks. The last row is always
+// 0 0 0 1, so it is never multiplied.
+class RigidTransform
+{
+public:
+    // The identity transform.
+    RigidTransform();
+
+    // rotation is 3x3 and translation is 3x1.
+    RigidTransform(const Matrix &rotation, const Matrix &translation);
+
+    // Rz(theta) * Tz(d) * Tx(a) * Rx(alpha)
+    static RigidTransform FromDenavitHartenberg(const DenavitHartenberg &row);
+
+    // [R1 t1] * [R2 t2] = [R1 * R2, R1 * t2 + t1]
+    RigidTransform operator*(const RigidTransform &other) const;
+
+    // [R^T, -R^T * t], which needs no elimination.
+    RigidTransform Inverse() const;
+
+    const Matrix & GetRotation() const;
+
+    const Matrix & GetTranslation() const;
+
+    // The full 4x4 matrix.
+    Matrix ToMatrix() const;
+
+    // The upper 3x4 block in column-major order.
+    std::vector<S> GetElements() const;
+
+    std::ostream & ToStream(std::ostream &output) const;
+
+private:
+    Matrix rotation_;
+    Matrix translation_;
+};
+
+
+std::ostream & operator<<(std::ostream &output, const RigidTransform &transform);
+
+
+/**
+  * The transform of each frame is composed from the previous one, so the
+  * transforms to every intermediate frame are available at no extra cost.
+**/
+class KinematicChain
+{
+public:
+    explicit KinematicChain(const std::vector<DenavitHartenberg> &rows);
+
+    size_t GetJointCount() const;
+
+    // The transform from the base to frame index, where frame 0 is the base
+    // and frame GetJointCount() is the end effector.
+    const RigidTransform & GetFrame(size_t index) const;
+
+    const RigidTransform & GetEndEffector() const;
+
+    // The arguments of the rows, in row order.
+    const std::vector<std::shared_ptr<Arg>> & GetArgs() const;
+
+    // Compiles the elements of the end effector (see
+    // RigidTransform::GetElements) with arguments ordered as GetArgs().
+    Compiled Compile() const;
+
+private:
+    std::vector<RigidTransform> frames_;
+    std::vector<std::shared_ptr<Arg>> args_;
+};
@@ -11,23 +11,84 @@
 
 #include "symbolic/matrix.h"
 #include "symbolic/settings.h"
+#include "symbolic/bareiss.h"
+#include "symbolic/derivative.h"
+#include "symbolic/interner.h"
+#include "symbolic/thread_pool.h"
 
 #include <fmt/core.h>
+#include <algorithm>
 #include <iostream>
 
 
 using Pointer = typename Symbol::Pointer;
 
 
+Structure GetStructure(const S &symbol)
+{
+    if (!symbol || !symbol->IsValue())
+    {
+        return Structure::general;
+    }
+
+    if (symbol->IsZero())
+    {
+        return Structure::zero;
+    }
+
+    if (symbol->IsOne())
+    {
+        return Structure::one;
+    }
+
+    return Structure::general;
+}
+
+
+Orthogonality Combine(Orthogonality left, Orthogonality right)
+{
+    if (left == Orthogonality::unknown || right == Orthogonality::unknown)
+    {
+        return Orthogonality::unknown;
+    }
+
+    if (left == Orthogonality::rotation && right == Orthogonality::rotation)
+    {
+        return Orthogonality::rotation;
+    }
+
+    return Orthogonality::orthonormal;
+}
+
+
 Matrix::Matrix(size_t rows, size_t columns)
     :
     rows_(rows),
     columns_(columns),
-    values_(columns, rows)
+    values_(columns, rows),
+    orthogonality_(Orthogonality::unknown),
+    tagged_()
 {
 
 }
 
+Matrix Matrix::Identity(size_t size)
+{
+    Matrix result(size, size);
+
+    for (size_t column = 0; column < size; ++column)
+    {
+        for (size_t row = 0; row < size; ++row)
+        {
+            result(row, column) = S((row == column) ? 1 : 0);
+        }
+    }
+
+    result.SetOrthogonality(Orthogonality::rotation);
+
+    return result;
+}
+
 S & Matrix::operator()(size_t row, size_t column)
 {
     return this->values_[column][row];
@@ -86,35 +147,291 @@ Matrix Matrix::operator/(S scalar) const
     return result;
 }
 
-Matrix Matrix::operator*(const Matrix &other) const
+MatrixChain Matrix::operator*(const Matrix &other) const
+{
+    return MatrixChain(*this, other);
+}
+
+MatrixChain Matrix::operator*(const MatrixChain &chain) const
+{
+    return MatrixChain(*this) * chain;
+}
+
+Matrix Matrix::Multiply(const Matrix &other) const
 {
     if (this->columns_ != other.rows_)
     {
         throw std::runtime_error("Incompatible dimensions");
     }
 
+    // Elements may have been assigned through references since the last
+    // product, so the structures are found again for each product.
+    auto leftPattern = this->GetPattern_();
+    auto rightPattern = other.GetPattern_();
+
     Matrix result(this->rows_, other.columns_);
 
     for (size_t column = 0; column < result.GetColumnCount(); ++column)
     {
         for (size_t row = 0; row < result.GetRowCount(); ++row)
         {
-            S element = this->operator()(row, 0) * other(0, column);
+            result(row, column) = this->MultiplyElement_(
+                other,
+                leftPattern,
+                rightPattern,
+                row,
+                column);
+        }
+    }
 
-            for (size_t i = 1; i < this->columns_; ++i)
+    result.SetOrthogonality(
+        Combine(this->GetOrthogonality(), other.GetOrthogonality()));
+
+    return result;
+}
+
+Matrix Matrix::Multiply(const Matrix &other, ThreadPool &pool) const
+{
+    if (this->columns_ != other.rows_)
+    {
+        throw std::runtime_error("Incompatible dimensions");
+    }
+
+    auto leftPattern = this->GetPattern_();
+    auto rightPattern = other.GetPattern_();
+
+    Matrix result(this->rows_, other.columns_);
+    size_t rows = result.rows_;
+
+    pool.ForEach(
+        rows * result.columns_,
+        [this, &other, &result, &leftPattern, &rightPattern, rows](
+            size_t index)
+        {
+            size_t row = index % rows;
+            size_t column = index / rows;
+
+            result(row, column) = this->MultiplyElement_(
+                other,
+                leftPattern,
+                rightPattern,
+                row,
+                column);
+        });
+
+    result.SetOrthogonality(
+        Combine(this->GetOrthogonality(), other.GetOrthogonality()));
+
+    return result;
+}
+
+S Matrix::MultiplyElement(
+    const Matrix &other,
+    size_t row,
+    size_t column) const
+{
+    return this->MultiplyElement_(
+        other,
+        this->GetPattern_(),
+        other.GetPattern_(),
+        row,
+        column);
+}
+
+S Matrix::MultiplyElement_(
+    const Matrix &other,
+    const std::vector<Structure> &leftPattern,
+    const std::vector<Structure> &rightPattern,
+    size_t row,
+    size_t column) const
+{
+    S element;
+
+    for (size_t i = 0; i < this->columns_; ++i)
+    {
+        auto leftStructure = leftPattern[i * this->rows_ + row];
+        auto rightStructure = rightPattern[column * other.rows_ + i];
+
+        if (leftStructure == Structure::zero
+                || rightStructure == Structure::zero)
+        {
+            continue;
+        }
+
+        S product;
+
+        if (leftStructure == Structure::one)
+        {
+            product = other.values_[column][i];
+        }
+        else if (rightStructure == Structure::one)
+        {
+            product = this->values_[i][row];
+        }
+        else
+        {
+            product = this->values_[i][row] * other.values_[column][i];
+        }
+
+        if (element)
+        {
+            element = element + product;
+        }
+        else
+        {
+            element = product;
+        }
+    }
+
+    if (!element)
+    {
+        return S(0);
+    }
+
+    return element;
+}
+
+S Matrix::Determinant() const
+{
+    if (this->GetOrthogonality() == Orthogonality::rotation)
+    {
+        return S(1);
+    }
+
+    return BareissDeterminant(*this);
+}
+
+Matrix Matrix::Inverse() const
+{
+    if (this->IsOrthonormal())
+    {
+        return this->Transpose();
+    }
+
+    return BareissSolve(*this, Identity(this->rows_));
+}
+
+Matrix Matrix::Solve(const Matrix &b) const
+{
+    if (this->IsOrthonormal())
+    {
+        if (b.rows_ != this->rows_)
+        {
+            throw std::runtime_error("Incompatible dimensions");
+        }
+
+        return this->Transpose().Multiply(b);
+    }
+
+    return BareissSolve(*this, b);
+}
+
+Matrix Matrix::Transpose() const
+{
+    Matrix result(this->columns_, this->rows_);
+
+    for (size_t column = 0; column < this->columns_; ++column)
+    {
+        for (size_t row = 0; row < this->rows_; ++row)
+        {
+            result.values_[row][column] = this->values_[column][row];
+        }
+    }
+
+    result.SetOrthogonality(this->GetOrthogonality());
+
+    return result;
+}
+
+Matrix Matrix::Jacobian(const std::vector<std::shared_ptr<Arg>> &args) const
+{
+    size_t count = this->rows_ * this->columns_;
+
+    // Interning the elements first lets each Differentiator visit shared
+    // subexpressions once, and interning the derivatives shares the factors
+    // they have in common.
+    Interner interner;
+    std::vector<S> elements;
+    elements.reserve(count);
+
+    for (size_t column = 0; column < this->columns_; ++column)
+    {
+        for (size_t row = 0; row < this->rows_; ++row)
+        {
+            elements.push_back(interner.Intern(this->values_[column][row]));
+        }
+    }
+
+    Matrix result(count, args.size());
+
+    for (size_t column = 0; column < args.size(); ++column)
+    {
+        Differentiator differentiator(args[column]);
+
+        for (size_t row = 0; row < count; ++row)
+        {
+            result(row, column) =
+                interner.Intern(differentiator(elements[row]));
+        }
+    }
+
+    return result;
+}
+
+
+Matrix & Matrix::SetOrthogonality(Orthogonality orthogonality)
+{
+    if (orthogonality != Orthogonality::unknown
+            && this->rows_ != this->columns_)
+    {
+        throw std::runtime_error("Only square matrices can be orthonormal");
+    }
+
+    this->orthogonality_ = orthogonality;
+    this->tagged_.clear();
+
+    if (orthogonality != Orthogonality::unknown)
+    {
+        this->tagged_.reserve(this->rows_ * this->columns_);
+
+        for (size_t column = 0; column < this->columns_; ++column)
+        {
+            for (size_t row = 0; row < this->rows_; ++row)
             {
-                auto left = this->operator()(row, i);
-                auto right = other.operator()(i, column);
-                auto product = left * right;
-                auto sum = element + product;
-                element = sum;
+                this->tagged_.push_back(this->values_[column][row]);
             }
+        }
+    }
+
+    return *this;
+}
+
+Orthogonality Matrix::GetOrthogonality() const
+{
+    if (this->orthogonality_ == Orthogonality::unknown)
+    {
+        return Orthogonality::unknown;
+    }
 
-            result(row, column) = element;
+    auto tagged = std::begin(this->tagged_);
+
+    for (size_t column = 0; column < this->columns_; ++column)
+    {
+        for (size_t row = 0; row < this->rows_; ++row)
+        {
+            if (this->values_[column][row] != *tagged++)
+            {
+                return Orthogonality::unknown;
+            }
         }
     }
 
-    return result;
+    return this->orthogonality_;
+}
+
+bool Matrix::IsOrthonormal() const
+{
+    return this->GetOrthogonality() != Orthogonality::unknown;
 }
 
 size_t Matrix::GetRowCount() const
@@ -127,6 +444,25 @@ size_t Matrix::GetColumnCount() const
     return this->columns_;
 }
 
+Structure Matrix::GetStructure(size_t row, size_t column) const
+{
+    return ::GetStructure(this->operator()(row, column));
+}
+
+size_t Matrix::GetNonZeroCount() const
+{
+    auto pattern = this->GetPattern_();
+
+    return static_cast<size_t>(
+        std::count_if(
+            std::begin(pattern),
+            std::end(pattern),
+            [](Structure structure)
+            {
+                return structure != Structure::zero;
+            }));
+}
+
 size_t Matrix::GetColumnWidth() const
 {
     size_t width = 0;
@@ -219,6 +555,25 @@ Matrix & Matrix::operator=(const std::vector<S> &symbols)
 }
 
 
+std::vector<Structure> Matrix::GetPattern_() const
+{
+    std::vector<Structure> pattern;
+    pattern.reserve(this->rows_ * this->columns_);
+
+    for (size_t column = 0; column < this->columns_; ++column)
+    {
+        const auto &columnValues = this->values_[column];
+
+        for (size_t row = 0; row < this->rows_; ++row)
+        {
+            pattern.push_back(::GetStructure(columnValues[row]));
+        }
+    }
+
+    return pattern;
+}
+
+
 std::ostream & operator<<(std::ostream &output, const Matrix &matrix)
 {
     return matrix.ToStream(output);
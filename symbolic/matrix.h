@@ -11,10 +11,45 @@
 
 #pragma once
 
+#include <vector>
 #include "symbol.h"
 #include "rank.h"
 
 
+// The structural role of a matrix element in a product.
+// Only exact values are classified as zero or one. Named symbols are always
+// general, even when their Arg is bound to a value that makes them vanish.
+enum class Structure
+{
+    zero,
+    one,
+    general
+};
+
+
+Structure GetStructure(const S &symbol);
+
+
+class ThreadPool;
+
+
+// What is known about the columns of a matrix.
+// A rotation is an orthonormal matrix with determinant 1.
+enum class Orthogonality
+{
+    unknown,
+    orthonormal,
+    rotation
+};
+
+
+// The orthogonality of a product of matrices.
+Orthogonality Combine(Orthogonality left, Orthogonality right);
+
+
+class MatrixChain;
+
+
 class Matrix
 {
 public:
@@ -22,6 +57,8 @@ public:
 
     Matrix(size_t rows, size_t columns);
 
+    static Matrix Identity(size_t size);
+
     S & operator()(size_t row, size_t column);
 
     const S & operator()(size_t row, size_t column) const;
@@ -31,6 +68,8 @@ public:
     {
         static_assert(IsValidOperator<op>::value);
 
+        this->SetOrthogonality(Orthogonality::unknown);
+
         for (size_t column = 0; column < this->columns_; ++column)
         {
             auto &columnValues = this->values_[column];
@@ -75,12 +114,61 @@ public:
 
     Matrix operator/(S scalar) const;
 
-    Matrix operator*(const Matrix &other) const;
+    // Products are evaluated lazily. See MatrixChain.
+    MatrixChain operator*(const Matrix &other) const;
+
+    MatrixChain operator*(const MatrixChain &chain) const;
+
+    // The eager pairwise product.
+    Matrix Multiply(const Matrix &other) const;
+
+    // The eager pairwise product, with the elements computed in parallel.
+    // The result does not depend on the count of threads in the pool.
+    Matrix Multiply(const Matrix &other, ThreadPool &pool) const;
+
+    // Computes a single element of the product this * other, skipping
+    // structural zeros and multiplications by one. The structure of every
+    // element is found on each call, so prefer Multiply for whole products.
+    S MultiplyElement(
+        const Matrix &other,
+        size_t row,
+        size_t column) const;
+
+    // Determinant, inverse and solve use fraction-free Bareiss elimination,
+    // unless the matrix is tagged orthonormal. See bareiss.h.
+    S Determinant() const;
+
+    Matrix Inverse() const;
+
+    // Solves this * x = b for x.
+    Matrix Solve(const Matrix &b) const;
+
+    Matrix Transpose() const;
+
+    // Row i, column j is the derivative of element i with respect to
+    // args[j], with the elements taken in column-major order. The
+    // derivatives share their common subexpressions.
+    Matrix Jacobian(const std::vector<std::shared_ptr<Arg>> &args) const;
+
+    // Tags the matrix as orthonormal or as a rotation. The tag is not
+    // verified. It is carried through products and transposes.
+    Matrix & SetOrthogonality(Orthogonality orthogonality);
+
+    // The tag holds only while every element is the one it was set with, so
+    // assigning an element, through any reference taken before or after
+    // tagging, drops it. Reading elements does not.
+    Orthogonality GetOrthogonality() const;
+
+    bool IsOrthonormal() const;
 
     size_t GetRowCount() const;
 
     size_t GetColumnCount() const;
 
+    Structure GetStructure(size_t row, size_t column) const;
+
+    size_t GetNonZeroCount() const;
+
     size_t GetColumnWidth() const;
 
     std::ostream & ToStream(std::ostream &output) const;
@@ -105,13 +193,34 @@ public:
     }
 
 private:
+    // The column-major structure of each element.
+    std::vector<Structure> GetPattern_() const;
+
+    S MultiplyElement_(
+        const Matrix &other,
+        const std::vector<Structure> &leftPattern,
+        const std::vector<Structure> &rightPattern,
+        size_t row,
+        size_t column) const;
+
     size_t rows_;
     size_t columns_;
 
     using Column = Rank<S>;
 
     Rank<Column> values_;
+
+    Orthogonality orthogonality_;
+
+    // The elements when the tag was set, in column-major order. Elements
+    // are replaced rather than modified, so comparing the pointers finds
+    // any assignment.
+    std::vector<Pointer> tagged_;
 };
 
 
 std::ostream & operator<<(std::ostream &output, const Matrix &matrix);
+
+
+// MatrixChain is returned by Matrix::operator*.
+#include "symbolic/matrix_chain.h"
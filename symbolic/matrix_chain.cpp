@@ -0,0 +1,559 @@
+/**
+  * @file matrix_chain.cpp
+  *
+  * @brief Implements lazy evaluation of matrix products.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#include "symbolic/matrix_chain.h"
+
+#include <fmt/core.h>
+#include <limits>
+#include <stdexcept>
+#include "symbolic/thread_pool.h"
+
+
+using Pattern = std::vector<Structure>;
+
+
+struct Combined
+{
+    Pattern pattern;
+
+    // The count of symbolic multiplications required.
+    size_t cost;
+};
+
+
+// Combines the column-major patterns of two factors into the pattern of
+// their product.
+static Combined CombinePatterns(
+    const Pattern &left,
+    const Pattern &right,
+    size_t rows,
+    size_t inner,
+    size_t columns)
+{
+    Combined result{Pattern(rows * columns, Structure::zero), 0};
+
+    for (size_t column = 0; column < columns; ++column)
+    {
+        for (size_t row = 0; row < rows; ++row)
+        {
+            size_t termCount = 0;
+            bool isOne = false;
+
+            for (size_t i = 0; i < inner; ++i)
+            {
+                auto leftStructure = left[i * rows + row];
+                auto rightStructure = right[column * inner + i];
+
+                if (leftStructure == Structure::zero
+                        || rightStructure == Structure::zero)
+                {
+                    continue;
+                }
+
+                ++termCount;
+
+                isOne = (leftStructure == Structure::one
+                    && rightStructure == Structure::one);
+
+                if (leftStructure == Structure::general
+                        && rightStructure == Structure::general)
+                {
+                    ++result.cost;
+                }
+            }
+
+            auto &structure = result.pattern[column * rows + row];
+
+            if (termCount == 0)
+            {
+                structure = Structure::zero;
+            }
+            else if (termCount == 1 && isOne)
+            {
+                structure = Structure::one;
+            }
+            else
+            {
+                structure = Structure::general;
+            }
+        }
+    }
+
+    return result;
+}
+
+
+static Pattern GetPattern(const Matrix &matrix)
+{
+    Pattern pattern;
+    pattern.reserve(matrix.GetRowCount() * matrix.GetColumnCount());
+
+    for (size_t column = 0; column < matrix.GetColumnCount(); ++column)
+    {
+        for (size_t row = 0; row < matrix.GetRowCount(); ++row)
+        {
+            pattern.push_back(matrix.GetStructure(row, column));
+        }
+    }
+
+    return pattern;
+}
+
+
+class MatrixChain::Node_
+{
+public:
+    Node_(const Matrix &factor, size_t index)
+        :
+        factor_(&factor),
+        index_(index),
+        left_(),
+        right_(),
+        rows_(factor.GetRowCount()),
+        columns_(factor.GetColumnCount()),
+        pattern_(),
+        values_()
+    {
+
+    }
+
+    Node_(
+        std::unique_ptr<Node_> left,
+        std::unique_ptr<Node_> right,
+        Pattern pattern)
+        :
+        factor_(nullptr),
+        index_(0),
+        left_(std::move(left)),
+        right_(std::move(right)),
+        rows_(this->left_->rows_),
+        columns_(this->right_->columns_),
+        pattern_(std::move(pattern)),
+        values_(this->rows_ * this->columns_)
+    {
+
+    }
+
+    size_t GetRowCount() const
+    {
+        return this->rows_;
+    }
+
+    size_t GetColumnCount() const
+    {
+        return this->columns_;
+    }
+
+    Structure GetStructure(size_t row, size_t column) const
+    {
+        if (this->factor_)
+        {
+            return this->factor_->GetStructure(row, column);
+        }
+
+        return this->pattern_[column * this->rows_ + row];
+    }
+
+    S Get(size_t row, size_t column)
+    {
+        if (this->factor_)
+        {
+            return (*this->factor_)(row, column);
+        }
+
+        auto &value = this->values_[column * this->rows_ + row];
+
+        if (!value)
+        {
+            value = this->Compute_(row, column);
+        }
+
+        return value;
+    }
+
+    // Computes every element of this product and of the products it
+    // depends on that was not computed before. Afterwards, Get only reads.
+    void Compute(ThreadPool &pool)
+    {
+        if (this->factor_)
+        {
+            return;
+        }
+
+        this->left_->Compute(pool);
+        this->right_->Compute(pool);
+
+        size_t rows = this->rows_;
+
+        pool.ForEach(
+            this->values_.size(),
+            [this, rows](size_t index)
+            {
+                auto &value = this->values_[index];
+
+                if (!value)
+                {
+                    value = this->Compute_(index % rows, index / rows);
+                }
+            });
+    }
+
+    std::string Describe() const
+    {
+        if (this->factor_)
+        {
+            return fmt::format("A{}", this->index_);
+        }
+
+        return fmt::format(
+            "({} * {})",
+            this->left_->Describe(),
+            this->right_->Describe());
+    }
+
+private:
+    S Compute_(size_t row, size_t column)
+    {
+        size_t inner = this->left_->columns_;
+
+        S element;
+
+        for (size_t i = 0; i < inner; ++i)
+        {
+            if (this->left_->GetStructure(row, i) == Structure::zero
+                    || this->right_->GetStructure(i, column)
+                        == Structure::zero)
+            {
+                continue;
+            }
+
+            // Computed elements may have cancelled to an exact value, so
+            // classify the actual operands again.
+            auto left = this->left_->Get(row, i);
+            auto leftStructure = ::GetStructure(left);
+
+            if (leftStructure == Structure::zero)
+            {
+                continue;
+            }
+
+            auto right = this->right_->Get(i, column);
+            auto rightStructure = ::GetStructure(right);
+
+            if (rightStructure == Structure::zero)
+            {
+                continue;
+            }
+
+            S product;
+
+            if (leftStructure == Structure::one)
+            {
+                product = right;
+            }
+            else if (rightStructure == Structure::one)
+            {
+                product = left;
+            }
+            else
+            {
+                product = left * right;
+            }
+
+            if (element)
+            {
+                element = element + product;
+            }
+            else
+            {
+                element = product;
+            }
+        }
+
+        if (!element)
+        {
+            return S(0);
+        }
+
+        return element;
+    }
+
+    const Matrix *factor_;
+    size_t index_;
+    std::unique_ptr<Node_> left_;
+    std::unique_ptr<Node_> right_;
+    size_t rows_;
+    size_t columns_;
+    Pattern pattern_;
+    std::vector<S> values_;
+};
+
+
+MatrixChain::MatrixChain(const Matrix &matrix)
+    :
+    factors_{matrix},
+    plan_()
+{
+
+}
+
+
+MatrixChain::MatrixChain(const Matrix &first, const Matrix &second)
+    :
+    factors_{first, second},
+    plan_()
+{
+    if (first.GetColumnCount() != second.GetRowCount())
+    {
+        throw std::runtime_error("Incompatible dimensions");
+    }
+}
+
+
+MatrixChain::MatrixChain(const MatrixChain &other)
+    :
+    factors_(other.factors_),
+    plan_()
+{
+
+}
+
+
+MatrixChain & MatrixChain::operator=(const MatrixChain &other)
+{
+    this->factors_ = other.factors_;
+    this->plan_.reset();
+
+    return *this;
+}
+
+
+MatrixChain MatrixChain::operator*(const Matrix &next) const
+{
+    if (this->GetColumnCount() != next.GetRowCount())
+    {
+        throw std::runtime_error("Incompatible dimensions");
+    }
+
+    MatrixChain result = *this;
+    result.factors_.push_back(next);
+
+    return result;
+}
+
+
+MatrixChain MatrixChain::operator*(const MatrixChain &next) const
+{
+    if (this->GetColumnCount() != next.GetRowCount())
+    {
+        throw std::runtime_error("Incompatible dimensions");
+    }
+
+    MatrixChain result = *this;
+
+    result.factors_.insert(
+        std::end(result.factors_),
+        std::begin(next.factors_),
+        std::end(next.factors_));
+
+    return result;
+}
+
+
+size_t MatrixChain::GetRowCount() const
+{
+    return this->factors_.front().GetRowCount();
+}
+
+
+size_t MatrixChain::GetColumnCount() const
+{
+    return this->factors_.back().GetColumnCount();
+}
+
+
+size_t MatrixChain::GetFactorCount() const
+{
+    return this->factors_.size();
+}
+
+
+S MatrixChain::operator()(size_t row, size_t column) const
+{
+    if (row >= this->GetRowCount() || column >= this->GetColumnCount())
+    {
+        throw std::out_of_range("Element out of range");
+    }
+
+    return this->GetPlan_().Get(row, column);
+}
+
+
+Matrix MatrixChain::Evaluate() const
+{
+    return this->Collect_(this->GetPlan_());
+}
+
+
+Matrix MatrixChain::Evaluate(ThreadPool &pool) const
+{
+    auto &plan = this->GetPlan_();
+    plan.Compute(pool);
+
+    return this->Collect_(plan);
+}
+
+
+MatrixChain::operator Matrix() const
+{
+    return this->Evaluate();
+}
+
+
+std::string MatrixChain::GetOrder() const
+{
+    return this->GetPlan_().Describe();
+}
+
+
+std::ostream & MatrixChain::ToStream(std::ostream &output) const
+{
+    return this->Evaluate().ToStream(output);
+}
+
+
+Matrix MatrixChain::Collect_(Node_ &plan) const
+{
+    Matrix result(plan.GetRowCount(), plan.GetColumnCount());
+
+    for (size_t column = 0; column < result.GetColumnCount(); ++column)
+    {
+        for (size_t row = 0; row < result.GetRowCount(); ++row)
+        {
+            result(row, column) = plan.Get(row, column);
+        }
+    }
+
+    auto orthogonality = this->factors_.front().GetOrthogonality();
+
+    for (size_t i = 1; i < this->factors_.size(); ++i)
+    {
+        orthogonality =
+            Combine(orthogonality, this->factors_[i].GetOrthogonality());
+    }
+
+    result.SetOrthogonality(orthogonality);
+
+    return result;
+}
+
+
+MatrixChain::Node_ & MatrixChain::GetPlan_() const
+{
+    if (!this->plan_)
+    {
+        this->plan_ = this->Plan_();
+    }
+
+    return *this->plan_;
+}
+
+
+std::unique_ptr<MatrixChain::Node_> MatrixChain::Plan_() const
+{
+    size_t count = this->factors_.size();
+
+    // Patterns and costs of every contiguous sub-chain, indexed [first][last].
+    // The pattern of a sub-chain does not depend on its grouping.
+    std::vector<std::vector<Pattern>> patterns(count);
+    std::vector<std::vector<size_t>> costs(count);
+    std::vector<std::vector<size_t>> splits(count);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        patterns[i].resize(count);
+        costs[i].resize(count, 0);
+        splits[i].resize(count, 0);
+        patterns[i][i] = GetPattern(this->factors_[i]);
+    }
+
+    auto rows = [this](size_t index)
+    {
+        return this->factors_[index].GetRowCount();
+    };
+
+    auto columns = [this](size_t index)
+    {
+        return this->factors_[index].GetColumnCount();
+    };
+
+    for (size_t length = 2; length <= count; ++length)
+    {
+        for (size_t first = 0; first + length <= count; ++first)
+        {
+            size_t last = first + length - 1;
+            size_t best = std::numeric_limits<size_t>::max();
+
+            // Search from the left-to-right grouping first, so that it wins
+            // ties.
+            for (size_t split = last; split-- > first;)
+            {
+                auto combined = CombinePatterns(
+                    patterns[first][split],
+                    patterns[split + 1][last],
+                    rows(first),
+                    columns(split),
+                    columns(last));
+
+                size_t cost =
+                    costs[first][split]
+                    + costs[split + 1][last]
+                    + combined.cost;
+
+                if (cost < best)
+                {
+                    best = cost;
+                    costs[first][last] = cost;
+                    splits[first][last] = split;
+
+                    if (patterns[first][last].empty())
+                    {
+                        patterns[first][last] = std::move(combined.pattern);
+                    }
+                }
+            }
+        }
+    }
+
+    auto build = [&](auto &&self, size_t first, size_t last)
+        -> std::unique_ptr<Node_>
+    {
+        if (first == last)
+        {
+            return std::make_unique<Node_>(this->factors_[first], first);
+        }
+
+        size_t split = splits[first][last];
+
+        return std::make_unique<Node_>(
+            self(self, first, split),
+            self(self, split + 1, last),
+            patterns[first][last]);
+    };
+
+    return build(build, 0, count - 1);
+}
+
+
+std::ostream & operator<<(std::ostream &output, const MatrixChain &chain)
+{
+    return chain.ToStream(output);
+}
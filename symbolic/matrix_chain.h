@@ -0,0 +1,96 @@
+/**
+  * @file matrix_chain.h
+  *
+  * @brief A lazily evaluated product of matrices.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "symbolic/matrix.h"
+
+
+/**
+  * Matrix::operator* collects its operands into a MatrixChain instead of
+  * computing a product. Elements are computed on request, and each element
+  * of an intermediate product is computed at most once, and only when a
+  * requested element depends on it.
+  *
+  * The grouping of the factors is chosen by a matrix-chain cost model that
+  * counts the symbolic multiplications left after skipping structural zeros.
+  * When two groupings cost the same, the left-to-right grouping is kept.
+  *
+  * The factors are held by value, so a chain never dangles. The grouping
+  * and every element computed so far are kept by the chain, so requesting
+  * elements one at a time costs no more than evaluating the whole product.
+  * Because of this, a chain must not be used from several threads at once.
+  * Copies start without the computed elements.
+**/
+class MatrixChain
+{
+public:
+    explicit MatrixChain(const Matrix &matrix);
+
+    MatrixChain(const Matrix &first, const Matrix &second);
+
+    MatrixChain(const MatrixChain &other);
+
+    MatrixChain(MatrixChain &&other) = default;
+
+    MatrixChain & operator=(const MatrixChain &other);
+
+    MatrixChain & operator=(MatrixChain &&other) = default;
+
+    MatrixChain operator*(const Matrix &next) const;
+
+    MatrixChain operator*(const MatrixChain &next) const;
+
+    size_t GetRowCount() const;
+
+    size_t GetColumnCount() const;
+
+    size_t GetFactorCount() const;
+
+    // Computes a single element of the product.
+    S operator()(size_t row, size_t column) const;
+
+    Matrix Evaluate() const;
+
+    // Computes every intermediate product in turn, with the elements not
+    // already computed found in parallel. The result does not depend on the
+    // count of threads in the pool.
+    Matrix Evaluate(ThreadPool &pool) const;
+
+    operator Matrix() const;
+
+    // Describes the chosen grouping, for example "(A0 * (A1 * A2))".
+    std::string GetOrder() const;
+
+    std::ostream & ToStream(std::ostream &output) const;
+
+private:
+    class Node_;
+
+    // The grouping, planned on first use.
+    Node_ & GetPlan_() const;
+
+    std::unique_ptr<Node_> Plan_() const;
+
+    Matrix Collect_(Node_ &plan) const;
+
+    std::vector<Matrix> factors_;
+
+    // The nodes of the plan point into factors_, so the plan is never
+    // shared between chains.
+    mutable std::shared_ptr<Node_> plan_;
+};
+
+
+std::ostream & operator<<(std::ostream &output, const MatrixChain &chain);
@@ -12,6 +12,7 @@
 #include "named.h"
 
 #include <cassert>
+#include <cmath>
 
 
 using Pointer = typename Symbol::Pointer;
@@ -198,6 +199,11 @@ Pointer Named::MultiplyPower(Pointer power) const
 
 Pointer Named::operator+(Pointer other) const
 {
+    if (auto exact = this->GetExactValue())
+    {
+        return exact->operator+(other);
+    }
+
     auto otherNamed = dynamic_cast<Named *>(other.get());
 
     if (otherNamed)
@@ -226,6 +232,11 @@ Pointer Named::operator+(Pointer other) const
 
 Pointer Named::operator-(Pointer other) const
 {
+    if (auto exact = this->GetExactValue())
+    {
+        return exact->operator-(other);
+    }
+
     auto otherNamed = dynamic_cast<Named *>(other.get());
 
     if (otherNamed)
@@ -253,6 +264,11 @@ Pointer Named::operator-(Pointer other) const
 
 Pointer Named::operator*(const Value &other) const
 {
+    if (auto exact = this->GetExactValue())
+    {
+        return exact->operator*(other);
+    }
+
     auto valueResult = this->scalar_ * other;
     auto asValue = dynamic_cast<Value *>(valueResult.get());
 
@@ -272,6 +288,11 @@ Pointer Named::operator*(const Value &other) const
 
 Pointer Named::operator/(const Value &other) const
 {
+    if (auto exact = this->GetExactValue())
+    {
+        return exact->operator/(other);
+    }
+
     if (other == 0)
     {
         throw std::runtime_error("divide by zero");
@@ -286,6 +307,11 @@ Pointer Named::operator/(const Value &other) const
 
 Pointer Named::operator*(Pointer other) const
 {
+    if (auto exact = this->GetExactValue())
+    {
+        return exact->operator*(other);
+    }
+
     auto otherNamed = dynamic_cast<Named *>(other.get());
 
     if (otherNamed)
@@ -319,6 +345,11 @@ Pointer Named::operator*(Pointer other) const
 
 Pointer Named::operator/(Pointer other) const
 {
+    if (auto exact = this->GetExactValue())
+    {
+        return exact->operator/(other);
+    }
+
     auto otherNamed = dynamic_cast<Named *>(other.get());
 
     if (otherNamed)
@@ -352,11 +383,11 @@ Pointer Named::operator/(Pointer other) const
 
 std::ostream & Named::ToStream(std::ostream &output) const
 {
-    auto value = this->GetValue<int>();
-
-    if (value)
+    // Only exact values are printed. Any other value bound to the argument
+    // is printed symbolically, as IsZero and IsOne ignore it.
+    if (auto exact = this->GetExactValue())
     {
-        return output << *value;
+        return output << *exact;
     }
 
     if (this->power_ == 0)
@@ -436,50 +467,43 @@ bool Named::Equals(Pointer other) const
 }
 
 
-bool Named::IsOne() const
+size_t Named::Hash() const
 {
-    if (this->power_ == 0 && this->scalar_ == 1)
-    {
-        return true;
-    }
+    size_t result = static_cast<size_t>(this->name_.GetFunction());
+    result = HashCombine(result, this->name_.GetArgId());
+    result = HashCombine(result, this->scalar_.Hash());
 
-    auto value = this->name_.GetValue<double>();
+    return HashCombine(result, this->power_.Hash());
+}
 
-    if (value)
+
+bool Named::IsOne() const
+{
+    if (auto exact = this->GetExactValue())
     {
-        return std::abs(*value - 1.0) < 0.001;
+        return exact->IsOne();
     }
-    
-    return false;
+
+    return this->power_ == 0 && this->scalar_ == 1;
 }
 
 
 bool Named::IsNegativeOne() const
 {
-    if (this->power_ == 0 && this->scalar_ == -1)
+    if (auto exact = this->GetExactValue())
     {
-        return true;
+        return exact->IsNegativeOne();
     }
 
-    auto value = this->name_.GetValue<double>();
-
-    if (value)
-    {
-        return std::abs(*value + 1.0) < 0.001;
-    }
-    
-    return false;
+    return this->power_ == 0 && this->scalar_ == -1;
 }
 
 
 bool Named::IsZero() const
 {
-    auto value = this->name_.GetValue<double>();
-
-    if (value)
+    if (auto exact = this->GetExactValue())
     {
-        return std::abs(*value) < 0.001;
-
+        return exact->IsZero();
     }
 
     return (this->scalar_ == 0);
@@ -488,6 +512,11 @@ bool Named::IsZero() const
 
 bool Named::IsNegative() const
 {
+    if (auto exact = this->GetExactValue())
+    {
+        return exact->IsNegative();
+    }
+
     auto value = this->name_.GetValue<double>();
 
     if (!value)
@@ -534,3 +563,109 @@ bool Named::SortProduct(Pointer other) const
 
     return this->name_.IsTrig() && otherNamed->name_.IsTrig();
 }
+
+
+// base^exponent for a small non-negative exponent.
+static int IntegerPower(int base, int exponent)
+{
+    int result = 1;
+
+    while (exponent-- > 0)
+    {
+        result *= base;
+    }
+
+    return result;
+}
+
+
+// The root when value is a perfect square.
+static std::optional<int> SquareRoot(int value)
+{
+    auto root = static_cast<int>(std::lround(std::sqrt(value)));
+
+    if (root * root != value)
+    {
+        return {};
+    }
+
+    return root;
+}
+
+
+std::optional<Value> Named::GetExactValue() const
+{
+    auto exact = this->name_.GetExactValue();
+
+    if (!exact)
+    {
+        return {};
+    }
+
+    return this->GetExactValue(*exact);
+}
+
+
+std::optional<Value> Named::GetExactValue(const ExactTrig &exact) const
+{
+    if (!this->power_.IsIntegral())
+    {
+        return {};
+    }
+
+    int power = this->power_.GetIntegral();
+
+    if (power == 0)
+    {
+        return this->scalar_;
+    }
+
+    if (exact.sign == 0)
+    {
+        if (power < 0)
+        {
+            return {};
+        }
+
+        return Value(0);
+    }
+
+    int magnitude = std::abs(power);
+
+    // exact is sign * sqrt(numerator / denominator).
+    int numerator;
+    int denominator;
+
+    if (magnitude % 2 == 0)
+    {
+        numerator = IntegerPower(exact.numerator, magnitude / 2);
+        denominator = IntegerPower(exact.denominator, magnitude / 2);
+    }
+    else
+    {
+        auto numeratorRoot = SquareRoot(exact.numerator);
+        auto denominatorRoot = SquareRoot(exact.denominator);
+
+        if (!numeratorRoot || !denominatorRoot)
+        {
+            // A radical does not fold into an exact rational Value.
+            return {};
+        }
+
+        numerator = IntegerPower(*numeratorRoot, magnitude);
+        denominator = IntegerPower(*denominatorRoot, magnitude);
+    }
+
+    if (exact.sign < 0 && magnitude % 2 == 1)
+    {
+        numerator = -numerator;
+    }
+
+    Value result = (power > 0)
+        ? Value(numerator, denominator)
+        : Value(denominator, numerator);
+
+    result *= this->scalar_;
+
+    return result;
+}
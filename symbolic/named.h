@@ -75,6 +75,8 @@ public:
 
     bool Equals(Pointer other) const override;
 
+    size_t Hash() const override;
+
     bool IsOne() const override;
 
     bool IsNegativeOne() const override;
@@ -85,6 +87,13 @@ public:
 
     bool SortProduct(Pointer other) const override;
 
+    // The exact value of a trig function of an exact angle, with the scalar
+    // and power applied, when it is rational.
+    std::optional<Value> GetExactValue() const;
+
+    // The exact value of this term when its function has the value exact.
+    std::optional<Value> GetExactValue(const ExactTrig &exact) const;
+
     template<typename T>
     std::optional<T> GetValue() const
     {
@@ -109,11 +118,40 @@ public:
         }
     }
 
-    std::shared_ptr<Arg> GetArg()
+    template<typename T>
+    std::optional<T> GetValue(const Frame &frame) const
+    {
+        auto value = this->name_.GetValue<double>(frame);
+
+        if (!value)
+        {
+            return {};
+        }
+
+        auto result =
+            this->scalar_.GetValue<double>()
+            * std::pow(*value, this->power_.GetValue<double>());
+
+        if constexpr (std::is_integral_v<T>)
+        {
+            return static_cast<T>(std::round(result));
+        }
+        else
+        {
+            return static_cast<T>(result);
+        }
+    }
+
+    std::shared_ptr<Arg> GetArg() const
     {
         return this->name_.GetArg();
     }
 
+    const SymbolName & GetSymbolName() const
+    {
+        return this->name_;
+    }
+
 private:
     SymbolName name_;
     Value scalar_;
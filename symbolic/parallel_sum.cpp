@@ -0,0 +1,229 @@
+/**
+  * @file parallel_sum.cpp
+  *
+  * @brief Implements parallel collection of like terms.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#include "symbolic/parallel_sum.h"
+
+#include <algorithm>
+#include <array>
+#include <unordered_map>
+#include "symbolic/expression.h"
+#include "symbolic/thread_pool.h"
+
+
+using Pointer = typename Symbol::Pointer;
+
+
+// The count of partitions is fixed, so that the partitions, and so the
+// work done in each of them, do not depend on the count of threads.
+static constexpr size_t partitionBits = 6;
+static constexpr size_t partitionCount = size_t{1} << partitionBits;
+
+// Terms hashed by each task.
+static constexpr size_t blockSize = 1024;
+
+
+struct Group
+{
+    // The index of the first term, which orders the groups.
+    size_t first;
+
+    std::vector<Pointer> items;
+    Pointer sum;
+};
+
+
+static std::vector<Pointer> Flatten(const std::vector<S> &terms)
+{
+    std::vector<Pointer> result;
+    result.reserve(terms.size());
+
+    for (const auto &term: terms)
+    {
+        auto expression = dynamic_cast<const Expression *>(term.get());
+
+        if (expression)
+        {
+            auto inner = expression->GetTerms(Op::add);
+
+            result.insert(
+                std::end(result),
+                std::begin(inner),
+                std::end(inner));
+        }
+        else
+        {
+            result.push_back(term);
+        }
+    }
+
+    return result;
+}
+
+
+// Collects the terms of one partition in order, as CollectSums does.
+static std::vector<Group> CollectPartition(
+    const std::vector<Pointer> &terms,
+    const std::vector<size_t> &hashes,
+    const std::vector<size_t> &indices)
+{
+    std::vector<Group> groups;
+
+    // Groups by like-term hash, in order of creation.
+    std::unordered_map<size_t, std::vector<size_t>> byHash;
+
+    for (auto index: indices)
+    {
+        const auto &term = terms[index];
+        auto &candidates = byHash[hashes[index]];
+
+        auto found = std::find_if(
+            std::begin(candidates),
+            std::end(candidates),
+            [&groups, &term](size_t group)
+            {
+                return groups[group].items.front()->ScalarsAdd(term);
+            });
+
+        if (found != std::end(candidates))
+        {
+            groups[*found].items.push_back(term);
+        }
+        else
+        {
+            candidates.push_back(groups.size());
+            groups.push_back({index, {term}, {}});
+        }
+    }
+
+    for (auto &group: groups)
+    {
+        group.sum = Expression::AddLikeTerms(group.items);
+    }
+
+    return groups;
+}
+
+
+// Joins the groups in the order that serial collection creates them.
+static S Join(std::vector<const Group *> groups)
+{
+    std::sort(
+        std::begin(groups),
+        std::end(groups),
+        [](const Group *left, const Group *right)
+        {
+            return left->first < right->first;
+        });
+
+    std::vector<Pointer> collectedTerms;
+    collectedTerms.reserve(groups.size());
+
+    for (const auto *group: groups)
+    {
+        collectedTerms.push_back(group->sum);
+    }
+
+    return Expression::AddCollected(std::move(collectedTerms));
+}
+
+
+S Sum(const std::vector<S> &terms)
+{
+    auto flattened = Flatten(terms);
+
+    if (flattened.empty())
+    {
+        return S(0);
+    }
+
+    std::vector<size_t> hashes;
+    std::vector<size_t> indices;
+    hashes.reserve(flattened.size());
+    indices.reserve(flattened.size());
+
+    for (const auto &term: flattened)
+    {
+        indices.push_back(hashes.size());
+        hashes.push_back(term->ClearScalar()->Hash());
+    }
+
+    auto collected = CollectPartition(flattened, hashes, indices);
+
+    std::vector<const Group *> groups;
+    groups.reserve(collected.size());
+
+    for (const auto &group: collected)
+    {
+        groups.push_back(&group);
+    }
+
+    return Join(std::move(groups));
+}
+
+
+S ParallelSum(const std::vector<S> &terms, ThreadPool &pool)
+{
+    auto flattened = Flatten(terms);
+
+    if (flattened.empty())
+    {
+        return S(0);
+    }
+
+    size_t count = flattened.size();
+
+    // Like terms differ only in their scalars, so they have the same hash
+    // once the scalar is cleared.
+    std::vector<size_t> hashes(count);
+
+    pool.ForEach(
+        (count + blockSize - 1) / blockSize,
+        [&flattened, &hashes, count](size_t block)
+        {
+            size_t last = std::min(count, (block + 1) * blockSize);
+
+            for (size_t i = block * blockSize; i < last; ++i)
+            {
+                hashes[i] = flattened[i]->ClearScalar()->Hash();
+            }
+        });
+
+    std::array<std::vector<size_t>, partitionCount> partitions;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        partitions[MixHash(hashes[i], partitionBits)].push_back(i);
+    }
+
+    std::array<std::vector<Group>, partitionCount> collected;
+
+    pool.ForEach(
+        partitionCount,
+        [&](size_t partition)
+        {
+            collected[partition] = CollectPartition(
+                flattened,
+                hashes,
+                partitions[partition]);
+        });
+
+    std::vector<const Group *> groups;
+
+    for (const auto &partition: collected)
+    {
+        for (const auto &group: partition)
+        {
+            groups.push_back(&group);
+        }
+    }
+
+    return Join(std::move(groups));
+}
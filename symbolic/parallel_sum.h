@@ -0,0 +1,42 @@
+/**
+  * @file parallel_sum.h
+  *
+  * @brief Collects the like terms of large sums on several threads.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#pragma once
+
+#include <vector>
+#include "symbolic/symbol.h"
+
+
+class ThreadPool;
+
+
+/**
+  * The sum of terms, collected in a single pass. Any sums among the terms
+  * are flattened first, and the groups of like terms are joined as
+  * Expression::operator+ joins the terms of its two operands.
+  *
+  * Folding the terms with operator+ collects again after every term, and
+  * may join the groups in another order: x + y + z + x is z + 2*x + y,
+  * while Sum({x, y, z, x}) is y + z + 2*x.
+**/
+S Sum(const std::vector<S> &terms);
+
+
+/**
+  * The same result as Sum(terms), for any count of threads.
+  *
+  * Sum searches every group of like terms collected so far for each new
+  * term. ParallelSum instead partitions the terms by a hash that ignores
+  * their scalars, so like terms always meet in the same partition, and
+  * collects the partitions on the threads of pool. The groups are then
+  * joined in order of their first term, as Sum joins them.
+**/
+S ParallelSum(const std::vector<S> &terms, ThreadPool &pool);
@@ -0,0 +1,910 @@
+/**
+  * @file polynomial.cpp
+  *
+  * @brief Implements multivariate polynomial arithmetic.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#include "symbolic/polynomial.h"
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+#include "symbolic/expression.h"
+#include "symbolic/named.h"
+#include "symbolic/thread_pool.h"
+
+
+using Pointer = typename Symbol::Pointer;
+using Monomial = typename Polynomial::Monomial;
+using Term = typename Polynomial::Term;
+
+
+static int GetExponent(const Pointer &power)
+{
+    auto value = dynamic_cast<const Value *>(power.get());
+
+    if (!value
+            || value->HasPower()
+            || !value->IsIntegral()
+            || value->GetIntegral() < 0)
+    {
+        throw std::runtime_error(
+            "Only non-negative integral powers can be expanded");
+    }
+
+    return value->GetIntegral();
+}
+
+
+static const Value & AsValue(const Pointer &symbol)
+{
+    auto value = dynamic_cast<const Value *>(symbol.get());
+
+    if (!value)
+    {
+        throw std::runtime_error("Expected a Value");
+    }
+
+    return *value;
+}
+
+
+// Returns the quotient when divisor divides dividend.
+static std::optional<Monomial> DivideMonomial(
+    const Monomial &dividend,
+    const Monomial &divisor)
+{
+    Monomial result;
+    auto item = std::begin(dividend);
+
+    for (const auto &[variable, exponent]: divisor)
+    {
+        while (item != std::end(dividend)
+                && Polynomial::CompareVariables(item->first, variable) < 0)
+        {
+            result.push_back(*item++);
+        }
+
+        if (item == std::end(dividend)
+                || item->first != variable
+                || item->second < exponent)
+        {
+            return {};
+        }
+
+        if (item->second > exponent)
+        {
+            result.emplace_back(variable, item->second - exponent);
+        }
+
+        ++item;
+    }
+
+    result.insert(std::end(result), item, std::end(dividend));
+
+    return result;
+}
+
+
+Polynomial::Polynomial()
+    :
+    terms_()
+{
+
+}
+
+
+Polynomial::Polynomial(const Value &constant)
+    :
+    terms_()
+{
+    if (!constant.IsZero())
+    {
+        this->terms_.push_back(Term{{}, constant});
+    }
+}
+
+
+Polynomial::Polynomial(const SymbolName &variable, int exponent)
+    :
+    terms_()
+{
+    if (exponent < 0)
+    {
+        throw std::runtime_error("Exponent must not be negative");
+    }
+
+    if (exponent == 0)
+    {
+        this->terms_.push_back(Term{{}, Value(1)});
+    }
+    else
+    {
+        this->terms_.push_back(Term{{{variable, exponent}}, Value(1)});
+    }
+}
+
+
+Polynomial::Polynomial(std::vector<Term> terms)
+    :
+    terms_(std::move(terms))
+{
+    this->Normalize_();
+}
+
+
+Polynomial Polynomial::FromSymbol(const Pointer &symbol)
+{
+    if (symbol->IsValue())
+    {
+        auto &value = AsValue(symbol);
+
+        if (!value.HasPower())
+        {
+            return Polynomial(value);
+        }
+
+        return Polynomial(AsValue(value.ClearPower()))
+            .Power(GetExponent(value.GetPower()));
+    }
+
+    if (symbol->IsNamed())
+    {
+        auto named = dynamic_cast<const Named *>(symbol.get());
+        assert(named);
+
+        return Polynomial(
+                named->GetSymbolName(),
+                GetExponent(named->GetPower()))
+            * AsValue(named->GetScalar());
+    }
+
+    auto expression = dynamic_cast<const Expression *>(symbol.get());
+
+    if (!expression)
+    {
+        throw std::runtime_error("Unsupported symbol");
+    }
+
+    auto left = FromSymbol(expression->GetLeft());
+    auto right = FromSymbol(expression->GetRight());
+
+    Polynomial inner;
+
+    switch (expression->GetOp())
+    {
+        case Op::add:
+            inner = left + right;
+            break;
+
+        case Op::subtract:
+            inner = left - right;
+            break;
+
+        case Op::multiply:
+            inner = left * right;
+            break;
+
+        case Op::divide:
+        {
+            auto quotient = left.ExactDivide(right);
+
+            if (!quotient)
+            {
+                throw std::runtime_error("Division is not exact");
+            }
+
+            inner = *quotient;
+            break;
+        }
+
+        default:
+            throw std::logic_error("Invalid operator");
+    }
+
+    return inner.Power(GetExponent(expression->GetPower()))
+        * FromSymbol(expression->GetScalar());
+}
+
+
+S Polynomial::ToSymbol() const
+{
+    if (this->terms_.empty())
+    {
+        return S(0);
+    }
+
+    // The terms are already collected, so they are joined with
+    // Expression::Add instead of searching for like terms again.
+    S result;
+
+    for (const auto &term: this->terms_)
+    {
+        S product = S(std::make_shared<Value>(term.coefficient));
+
+        for (const auto &[variable, exponent]: term.monomial)
+        {
+            product = product
+                * S(std::make_shared<Named>(
+                    variable,
+                    Value(1),
+                    Value(exponent)));
+        }
+
+        if (result)
+        {
+            result = Expression::Add(result, product);
+        }
+        else
+        {
+            result = product;
+        }
+    }
+
+    return result;
+}
+
+
+bool Polynomial::IsZero() const
+{
+    return this->terms_.empty();
+}
+
+
+bool Polynomial::IsConstant() const
+{
+    return this->terms_.empty()
+        || (this->terms_.size() == 1
+            && this->terms_.front().monomial.empty());
+}
+
+
+size_t Polynomial::GetTermCount() const
+{
+    return this->terms_.size();
+}
+
+
+const std::vector<Term> & Polynomial::GetTerms() const
+{
+    return this->terms_;
+}
+
+
+Polynomial Polynomial::operator+(const Polynomial &other) const
+{
+    std::vector<Term> terms;
+    terms.reserve(this->terms_.size() + other.terms_.size());
+
+    auto left = std::begin(this->terms_);
+    auto right = std::begin(other.terms_);
+
+    while (left != std::end(this->terms_) && right != std::end(other.terms_))
+    {
+        int order = CompareMonomials(left->monomial, right->monomial);
+
+        if (order > 0)
+        {
+            terms.push_back(*left++);
+        }
+        else if (order < 0)
+        {
+            terms.push_back(*right++);
+        }
+        else
+        {
+            auto coefficient = left->coefficient;
+            coefficient += right->coefficient;
+
+            if (!coefficient.IsZero())
+            {
+                terms.push_back(Term{left->monomial, coefficient});
+            }
+
+            ++left;
+            ++right;
+        }
+    }
+
+    terms.insert(std::end(terms), left, std::end(this->terms_));
+    terms.insert(std::end(terms), right, std::end(other.terms_));
+
+    Polynomial result;
+    result.terms_ = std::move(terms);
+
+    return result;
+}
+
+
+Polynomial Polynomial::operator-(const Polynomial &other) const
+{
+    return *this + other * Value(-1);
+}
+
+
+Polynomial Polynomial::operator*(const Polynomial &other) const
+{
+    std::vector<Term> terms;
+    terms.reserve(this->terms_.size() * other.terms_.size());
+
+    for (const auto &left: this->terms_)
+    {
+        for (const auto &right: other.terms_)
+        {
+            auto coefficient = left.coefficient;
+            coefficient *= right.coefficient;
+
+            terms.push_back(
+                Term{Multiply(left.monomial, right.monomial), coefficient});
+        }
+    }
+
+    return Polynomial(std::move(terms));
+}
+
+
+Polynomial Polynomial::Multiply(
+    const Polynomial &other,
+    ThreadPool &pool) const
+{
+    if (this->terms_.size() < other.terms_.size())
+    {
+        return other.Multiply(*this, pool);
+    }
+
+    if (other.terms_.empty())
+    {
+        return Polynomial();
+    }
+
+    // More chunks than threads, so that a thread finishing early can steal.
+    size_t termCount = this->terms_.size();
+    size_t chunkCount = std::min(termCount, 4 * (pool.GetThreadCount() + 1));
+
+    std::vector<Polynomial> partials(chunkCount);
+
+    pool.ForEach(
+        chunkCount,
+        [this, &other, &partials, termCount, chunkCount](size_t chunk)
+        {
+            partials[chunk] = this->MultiplyRange_(
+                other,
+                chunk * termCount / chunkCount,
+                (chunk + 1) * termCount / chunkCount);
+        });
+
+    // Merge neighboring pairs until one product is left.
+    while (partials.size() > 1)
+    {
+        std::vector<Polynomial> merged((partials.size() + 1) / 2);
+
+        pool.ForEach(
+            merged.size(),
+            [&partials, &merged](size_t i)
+            {
+                if (2 * i + 1 < partials.size())
+                {
+                    merged[i] = partials[2 * i] + partials[2 * i + 1];
+                }
+                else
+                {
+                    merged[i] = std::move(partials[2 * i]);
+                }
+            });
+
+        partials = std::move(merged);
+    }
+
+    return std::move(partials.front());
+}
+
+
+Polynomial Polynomial::operator*(const Value &scalar) const
+{
+    if (scalar.IsZero())
+    {
+        return Polynomial();
+    }
+
+    Polynomial result = *this;
+
+    for (auto &term: result.terms_)
+    {
+        term.coefficient *= scalar;
+    }
+
+    return result;
+}
+
+
+Polynomial Polynomial::Power(int exponent) const
+{
+    if (exponent < 0)
+    {
+        throw std::runtime_error("Exponent must not be negative");
+    }
+
+    Polynomial result(Value(1));
+    Polynomial base = *this;
+
+    while (exponent > 0)
+    {
+        if (exponent & 1)
+        {
+            result = result * base;
+        }
+
+        exponent >>= 1;
+
+        if (exponent > 0)
+        {
+            base = base * base;
+        }
+    }
+
+    return result;
+}
+
+
+Polynomial Polynomial::Truncate(int degree) const
+{
+    // Terms are sorted by decreasing degree.
+    auto first = std::partition_point(
+        std::begin(this->terms_),
+        std::end(this->terms_),
+        [degree](const Term &term)
+        {
+            return GetDegree(term.monomial) > degree;
+        });
+
+    Polynomial result;
+    result.terms_.assign(first, std::end(this->terms_));
+
+    return result;
+}
+
+
+Polynomial Polynomial::MultiplyTruncated(
+    const Polynomial &other,
+    int degree) const
+{
+    std::vector<Term> terms;
+
+    for (const auto &left: this->terms_)
+    {
+        int remaining = degree - GetDegree(left.monomial);
+
+        if (remaining < 0)
+        {
+            continue;
+        }
+
+        // Only the lowest degree terms of other fit.
+        auto first = std::partition_point(
+            std::begin(other.terms_),
+            std::end(other.terms_),
+            [remaining](const Term &term)
+            {
+                return GetDegree(term.monomial) > remaining;
+            });
+
+        for (auto right = first; right != std::end(other.terms_); ++right)
+        {
+            auto coefficient = left.coefficient;
+            coefficient *= right->coefficient;
+
+            terms.push_back(
+                Term{Multiply(left.monomial, right->monomial), coefficient});
+        }
+    }
+
+    return Polynomial(std::move(terms));
+}
+
+
+Polynomial Polynomial::MultiplyRange_(
+    const Polynomial &other,
+    size_t first,
+    size_t last) const
+{
+    // The next product of one term of this with a term of other.
+    struct Cursor
+    {
+        Monomial monomial;
+        size_t left;
+        size_t right;
+    };
+
+    auto isLess = [](const Cursor &left, const Cursor &right)
+    {
+        return CompareMonomials(left.monomial, right.monomial) < 0;
+    };
+
+    // Multiplying by a monomial preserves the order, so each term of this
+    // times the terms of other is a sorted sequence. The heap holds the
+    // head of each sequence, and pops the products in decreasing order.
+    std::vector<Cursor> heap;
+    heap.reserve(last - first);
+
+    for (size_t left = first; left < last; ++left)
+    {
+        heap.push_back(
+            Cursor{
+                Multiply(
+                    this->terms_[left].monomial,
+                    other.terms_.front().monomial),
+                left,
+                0});
+    }
+
+    std::make_heap(std::begin(heap), std::end(heap), isLess);
+
+    Polynomial result;
+    auto &terms = result.terms_;
+
+    while (!heap.empty())
+    {
+        std::pop_heap(std::begin(heap), std::end(heap), isLess);
+        auto cursor = std::move(heap.back());
+        heap.pop_back();
+
+        const auto &left = this->terms_[cursor.left];
+        auto coefficient = left.coefficient;
+        coefficient *= other.terms_[cursor.right].coefficient;
+
+        // Equal monomials are popped together.
+        if (!terms.empty()
+                && CompareMonomials(terms.back().monomial, cursor.monomial)
+                    == 0)
+        {
+            terms.back().coefficient += coefficient;
+        }
+        else
+        {
+            if (!terms.empty() && terms.back().coefficient.IsZero())
+            {
+                terms.pop_back();
+            }
+
+            terms.push_back(Term{std::move(cursor.monomial), coefficient});
+        }
+
+        size_t right = cursor.right + 1;
+
+        if (right < other.terms_.size())
+        {
+            heap.push_back(
+                Cursor{
+                    Multiply(left.monomial, other.terms_[right].monomial),
+                    cursor.left,
+                    right});
+
+            std::push_heap(std::begin(heap), std::end(heap), isLess);
+        }
+    }
+
+    if (!terms.empty() && terms.back().coefficient.IsZero())
+    {
+        terms.pop_back();
+    }
+
+    return result;
+}
+
+
+std::optional<Polynomial> Polynomial::ExactDivide(
+    const Polynomial &divisor) const
+{
+    if (divisor.IsZero())
+    {
+        throw std::runtime_error("Divide by zero");
+    }
+
+    const auto &leading = divisor.terms_.front();
+
+    // The next product of one quotient term with a term of divisor after
+    // the leading one.
+    struct Cursor
+    {
+        Monomial monomial;
+        size_t quotient;
+        size_t right;
+    };
+
+    auto isLess = [](const Cursor &left, const Cursor &right)
+    {
+        return CompareMonomials(left.monomial, right.monomial) < 0;
+    };
+
+    // The remainder is this, minus each quotient term times divisor. Each
+    // of those products is a sorted sequence, so instead of subtracting
+    // them one at a time, the heap merges them with the terms of this, as
+    // MultiplyRange_ does. The leading term of each product cancels the
+    // remainder term it was made from, so it is never pushed.
+    std::vector<Cursor> heap;
+    std::vector<Term> quotient;
+    auto next = std::begin(this->terms_);
+
+    while (next != std::end(this->terms_) || !heap.empty())
+    {
+        Monomial monomial;
+        Value coefficient(0);
+
+        if (heap.empty()
+                || (next != std::end(this->terms_)
+                    && CompareMonomials(
+                        next->monomial,
+                        heap.front().monomial) >= 0))
+        {
+            monomial = next->monomial;
+            coefficient = next->coefficient;
+            ++next;
+        }
+        else
+        {
+            monomial = heap.front().monomial;
+        }
+
+        // Equal monomials are popped together.
+        while (!heap.empty()
+                && CompareMonomials(heap.front().monomial, monomial) == 0)
+        {
+            std::pop_heap(std::begin(heap), std::end(heap), isLess);
+            auto &cursor = heap.back();
+
+            auto product = quotient[cursor.quotient].coefficient;
+            product *= divisor.terms_[cursor.right].coefficient;
+            coefficient -= product;
+
+            if (++cursor.right < divisor.terms_.size())
+            {
+                cursor.monomial = Multiply(
+                    quotient[cursor.quotient].monomial,
+                    divisor.terms_[cursor.right].monomial);
+
+                std::push_heap(std::begin(heap), std::end(heap), isLess);
+            }
+            else
+            {
+                heap.pop_back();
+            }
+        }
+
+        if (coefficient.IsZero())
+        {
+            continue;
+        }
+
+        // The leading term of the remainder.
+        auto quotientMonomial = DivideMonomial(monomial, leading.monomial);
+
+        if (!quotientMonomial)
+        {
+            return {};
+        }
+
+        coefficient /= leading.coefficient;
+        quotient.push_back(Term{std::move(*quotientMonomial), coefficient});
+
+        if (divisor.terms_.size() > 1)
+        {
+            heap.push_back(
+                Cursor{
+                    Multiply(
+                        quotient.back().monomial,
+                        divisor.terms_[1].monomial),
+                    quotient.size() - 1,
+                    1});
+
+            std::push_heap(std::begin(heap), std::end(heap), isLess);
+        }
+    }
+
+    Polynomial result;
+    result.terms_ = std::move(quotient);
+
+    return result;
+}
+
+
+bool Polynomial::operator==(const Polynomial &other) const
+{
+    if (this->terms_.size() != other.terms_.size())
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < this->terms_.size(); ++i)
+    {
+        if (CompareMonomials(
+                this->terms_[i].monomial,
+                other.terms_[i].monomial) != 0)
+        {
+            return false;
+        }
+
+        if (!(this->terms_[i].coefficient == other.terms_[i].coefficient))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+std::ostream & Polynomial::ToStream(std::ostream &output) const
+{
+    return this->ToSymbol()->ToStream(output);
+}
+
+
+int Polynomial::CompareVariables(
+    const SymbolName &left,
+    const SymbolName &right)
+{
+    int compare = SymbolName::CompareArgs(left, right);
+
+    if (compare != 0)
+    {
+        return compare;
+    }
+
+    return static_cast<int>(left.GetFunction())
+        - static_cast<int>(right.GetFunction());
+}
+
+
+int Polynomial::CompareMonomials(const Monomial &left, const Monomial &right)
+{
+    int leftDegree = GetDegree(left);
+    int rightDegree = GetDegree(right);
+
+    if (leftDegree != rightDegree)
+    {
+        return (leftDegree > rightDegree) ? 1 : -1;
+    }
+
+    auto leftPower = std::begin(left);
+    auto rightPower = std::begin(right);
+
+    while (leftPower != std::end(left) && rightPower != std::end(right))
+    {
+        int order = CompareVariables(leftPower->first, rightPower->first);
+
+        if (order < 0)
+        {
+            // left has a power of an earlier variable.
+            return 1;
+        }
+
+        if (order > 0)
+        {
+            return -1;
+        }
+
+        if (leftPower->second != rightPower->second)
+        {
+            return (leftPower->second > rightPower->second) ? 1 : -1;
+        }
+
+        ++leftPower;
+        ++rightPower;
+    }
+
+    if (leftPower != std::end(left))
+    {
+        return 1;
+    }
+
+    if (rightPower != std::end(right))
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
+
+int Polynomial::GetDegree(const Monomial &monomial)
+{
+    int degree = 0;
+
+    for (const auto &power: monomial)
+    {
+        degree += power.second;
+    }
+
+    return degree;
+}
+
+
+Monomial Polynomial::Multiply(const Monomial &left, const Monomial &right)
+{
+    Monomial result;
+    result.reserve(left.size() + right.size());
+
+    auto leftPower = std::begin(left);
+    auto rightPower = std::begin(right);
+
+    while (leftPower != std::end(left) && rightPower != std::end(right))
+    {
+        int order = CompareVariables(leftPower->first, rightPower->first);
+
+        if (order < 0)
+        {
+            result.push_back(*leftPower++);
+        }
+        else if (order > 0)
+        {
+            result.push_back(*rightPower++);
+        }
+        else
+        {
+            result.emplace_back(
+                leftPower->first,
+                leftPower->second + rightPower->second);
+
+            ++leftPower;
+            ++rightPower;
+        }
+    }
+
+    result.insert(std::end(result), leftPower, std::end(left));
+    result.insert(std::end(result), rightPower, std::end(right));
+
+    return result;
+}
+
+
+void Polynomial::Normalize_()
+{
+    std::sort(
+        std::begin(this->terms_),
+        std::end(this->terms_),
+        [](const Term &left, const Term &right)
+        {
+            return CompareMonomials(left.monomial, right.monomial) > 0;
+        });
+
+    std::vector<Term> combined;
+    combined.reserve(this->terms_.size());
+
+    for (auto &term: this->terms_)
+    {
+        if (!combined.empty()
+                && CompareMonomials(
+                    combined.back().monomial,
+                    term.monomial) == 0)
+        {
+            combined.back().coefficient += term.coefficient;
+        }
+        else
+        {
+            if (!combined.empty() && combined.back().coefficient.IsZero())
+            {
+                combined.pop_back();
+            }
+
+            combined.push_back(std::move(term));
+        }
+    }
+
+    if (!combined.empty() && combined.back().coefficient.IsZero())
+    {
+        combined.pop_back();
+    }
+
+    this->terms_ = std::move(combined);
+}
+
+
+std::ostream & operator<<(std::ostream &output, const Polynomial &polynomial)
+{
+    return polynomial.ToStream(output);
+}
@@ -0,0 +1,122 @@
+/**
+  * @file polynomial.h
+  *
+  * @brief Expanded multivariate polynomials with exact rational coefficients.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#pragma once
+
+#include <optional>
+#include <utility>
+#include <vector>
+#include "symbolic/symbol.h"
+#include "symbolic/value.h"
+
+
+class ThreadPool;
+
+
+/**
+  * Every distinct SymbolName is an independent variable, so sin(α) and
+  * cos(α) are unrelated as far as a Polynomial is concerned. Exact division
+  * is exact in that ring, which is what fraction-free elimination requires.
+**/
+class Polynomial
+{
+public:
+    // A variable and its (positive) exponent.
+    using Factor = std::pair<SymbolName, int>;
+
+    // Factors sorted by variable.
+    using Monomial = std::vector<Factor>;
+
+    struct Term
+    {
+        Monomial monomial;
+        Value coefficient;
+    };
+
+    Polynomial();
+
+    explicit Polynomial(const Value &constant);
+
+    Polynomial(const SymbolName &variable, int exponent);
+
+    // Expands a symbol.
+    // Throws std::runtime_error when the symbol has a negative or
+    // fractional power, or a divisor that does not divide exactly.
+    static Polynomial FromSymbol(const Symbol::Pointer &symbol);
+
+    S ToSymbol() const;
+
+    bool IsZero() const;
+
+    bool IsConstant() const;
+
+    size_t GetTermCount() const;
+
+    // Terms are sorted in decreasing graded lexicographic order.
+    const std::vector<Term> & GetTerms() const;
+
+    Polynomial operator+(const Polynomial &other) const;
+
+    Polynomial operator-(const Polynomial &other) const;
+
+    Polynomial operator*(const Polynomial &other) const;
+
+    Polynomial operator*(const Value &scalar) const;
+
+    // The product, computed on the threads of pool. The larger operand is
+    // split into chunks, and each chunk is multiplied by a heap merge that
+    // produces its terms already sorted and combined. The partial products
+    // are then merged in order. The result is the same as operator*.
+    Polynomial Multiply(const Polynomial &other, ThreadPool &pool) const;
+
+    Polynomial Power(int exponent) const;
+
+    // Discards the terms of degree greater than degree.
+    Polynomial Truncate(int degree) const;
+
+    // The product without the terms of degree greater than degree, which
+    // are skipped instead of computed.
+    Polynomial MultiplyTruncated(const Polynomial &other, int degree) const;
+
+    // Returns nothing when divisor does not divide this polynomial exactly.
+    std::optional<Polynomial> ExactDivide(const Polynomial &divisor) const;
+
+    bool operator==(const Polynomial &other) const;
+
+    std::ostream & ToStream(std::ostream &output) const;
+
+    // Total order of variables.
+    static int CompareVariables(const SymbolName &left, const SymbolName &right);
+
+    // Graded lexicographic order.
+    static int CompareMonomials(const Monomial &left, const Monomial &right);
+
+    static int GetDegree(const Monomial &monomial);
+
+    static Monomial Multiply(const Monomial &left, const Monomial &right);
+
+private:
+    explicit Polynomial(std::vector<Term> terms);
+
+    // The product of the terms [first, last) with other.
+    Polynomial MultiplyRange_(
+        const Polynomial &other,
+        size_t first,
+        size_t last) const;
+
+    // Sorts the terms, combines like terms and drops zeros.
+    void Normalize_();
+
+    std::vector<Term> terms_;
+};
+
+
+std::ostream & operator<<(std::ostream &output, const Polynomial &polynomial);
@@ -0,0 +1,405 @@
+/**
+  * @file power_series.cpp
+  *
+  * @brief Implements truncated power series.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#include "symbolic/power_series.h"
+
+#include <cassert>
+#include <map>
+#include <stdexcept>
+#include "symbolic/expression.h"
+#include "symbolic/named.h"
+#include "symbolic/value.h"
+
+
+using Pointer = typename Symbol::Pointer;
+
+
+static int GetIntegralPower(const Pointer &power)
+{
+    auto value = dynamic_cast<const Value *>(power.get());
+
+    if (!value || value->HasPower() || !value->IsIntegral())
+    {
+        throw std::runtime_error("Only integral powers can be expanded");
+    }
+
+    return value->GetIntegral();
+}
+
+
+// The series of a trig function, from sin and cos.
+static PowerSeries ExpandFunction(
+    Trig function,
+    const PowerSeries &argument)
+{
+    switch (function)
+    {
+        case Trig::sin:
+            return PowerSeries::Sin(argument);
+
+        case Trig::cos:
+            return PowerSeries::Cos(argument);
+
+        case Trig::tan:
+            return PowerSeries::Sin(argument)
+                * PowerSeries::Cos(argument).Reciprocal();
+
+        case Trig::sec:
+            return PowerSeries::Cos(argument).Reciprocal();
+
+        default:
+            throw std::runtime_error(
+                std::string(GetTrigInfo(function).name)
+                + " has no power series about zero");
+    }
+}
+
+
+// Remembers the expansion of each node, so that shared subexpressions are
+// expanded once.
+class SeriesExpander
+{
+public:
+    explicit SeriesExpander(int order)
+        :
+        order_(order),
+        memo_()
+    {
+
+    }
+
+    PowerSeries operator()(const Pointer &symbol)
+    {
+        auto found = this->memo_.find(symbol.get());
+
+        if (found != std::end(this->memo_))
+        {
+            return found->second.second;
+        }
+
+        auto result = this->Expand_(symbol);
+        this->memo_.emplace(symbol.get(), std::make_pair(symbol, result));
+
+        return result;
+    }
+
+private:
+    PowerSeries Expand_(const Pointer &symbol)
+    {
+        if (symbol->IsValue())
+        {
+            return PowerSeries(Polynomial::FromSymbol(symbol), this->order_);
+        }
+
+        if (symbol->IsNamed())
+        {
+            auto named = dynamic_cast<const Named *>(symbol.get());
+            assert(named);
+
+            // A fractional argument is a multiple of its root.
+            auto arg = named->GetArg();
+            int divisor = 1;
+
+            while (arg->GetParent())
+            {
+                divisor *= arg->GetDivisor();
+                arg = arg->GetParent();
+            }
+
+            PowerSeries series(
+                Polynomial(SymbolName(*arg), 1) * Value(1, divisor),
+                this->order_);
+
+            const auto &symbolName = named->GetSymbolName();
+
+            if (symbolName.IsTrig())
+            {
+                series = ExpandFunction(symbolName.GetFunction(), series);
+            }
+
+            return series.Power(GetIntegralPower(named->GetPower()))
+                * (*this)(named->GetScalar());
+        }
+
+        auto expression = dynamic_cast<const Expression *>(symbol.get());
+
+        if (!expression)
+        {
+            throw std::runtime_error("Unsupported symbol");
+        }
+
+        auto left = (*this)(expression->GetLeft());
+        auto right = (*this)(expression->GetRight());
+
+        PowerSeries inner(this->order_);
+
+        switch (expression->GetOp())
+        {
+            case Op::add:
+                inner = left + right;
+                break;
+
+            case Op::subtract:
+                inner = left - right;
+                break;
+
+            case Op::multiply:
+                inner = left * right;
+                break;
+
+            case Op::divide:
+                inner = left * right.Reciprocal();
+                break;
+
+            default:
+                throw std::logic_error("Invalid operator");
+        }
+
+        return inner.Power(GetIntegralPower(expression->GetPower()))
+            * (*this)(expression->GetScalar());
+    }
+
+    int order_;
+    std::map<const Symbol *, std::pair<Pointer, PowerSeries>> memo_;
+};
+
+
+PowerSeries::PowerSeries(int order)
+    :
+    PowerSeries(Polynomial(), order)
+{
+
+}
+
+
+PowerSeries::PowerSeries(const Polynomial &polynomial, int order)
+    :
+    polynomial_(polynomial.Truncate(order)),
+    order_(order)
+{
+    if (order < 0 || order > maxOrder)
+    {
+        throw std::runtime_error("Unsupported order");
+    }
+}
+
+
+PowerSeries PowerSeries::FromSymbol(const Pointer &symbol, int order)
+{
+    return SeriesExpander(order)(symbol);
+}
+
+
+PowerSeries PowerSeries::Sin(const PowerSeries &argument)
+{
+    if (!argument.GetConstant_().IsZero())
+    {
+        throw std::runtime_error("Expected no constant term");
+    }
+
+    // x - x^3/3! + x^5/5! - ...
+    PowerSeries result(argument.order_);
+    PowerSeries power = argument;
+    int factorial = 1;
+    int sign = 1;
+
+    for (int n = 1; n <= argument.order_; n += 2)
+    {
+        result = result + power * Value(sign, factorial);
+
+        power = power * argument * argument;
+        factorial *= (n + 1) * (n + 2);
+        sign = -sign;
+    }
+
+    return result;
+}
+
+
+PowerSeries PowerSeries::Cos(const PowerSeries &argument)
+{
+    if (!argument.GetConstant_().IsZero())
+    {
+        throw std::runtime_error("Expected no constant term");
+    }
+
+    // 1 - x^2/2! + x^4/4! - ...
+    PowerSeries result(Polynomial(Value(1)), argument.order_);
+    PowerSeries square = argument * argument;
+    PowerSeries power = square;
+    int factorial = 2;
+    int sign = -1;
+
+    for (int n = 2; n <= argument.order_; n += 2)
+    {
+        result = result + power * Value(sign, factorial);
+
+        power = power * square;
+        factorial *= (n + 1) * (n + 2);
+        sign = -sign;
+    }
+
+    return result;
+}
+
+
+int PowerSeries::GetOrder() const
+{
+    return this->order_;
+}
+
+
+const Polynomial & PowerSeries::GetPolynomial() const
+{
+    return this->polynomial_;
+}
+
+
+S PowerSeries::ToSymbol() const
+{
+    return this->polynomial_.ToSymbol();
+}
+
+
+PowerSeries PowerSeries::operator+(const PowerSeries &other) const
+{
+    return PowerSeries(
+        this->polynomial_ + other.polynomial_,
+        std::min(this->order_, other.order_));
+}
+
+
+PowerSeries PowerSeries::operator-(const PowerSeries &other) const
+{
+    return PowerSeries(
+        this->polynomial_ - other.polynomial_,
+        std::min(this->order_, other.order_));
+}
+
+
+PowerSeries PowerSeries::operator*(const PowerSeries &other) const
+{
+    int order = std::min(this->order_, other.order_);
+
+    return PowerSeries(
+        this->polynomial_.MultiplyTruncated(other.polynomial_, order),
+        order);
+}
+
+
+PowerSeries PowerSeries::operator*(const Value &scalar) const
+{
+    return PowerSeries(this->polynomial_ * scalar, this->order_);
+}
+
+
+PowerSeries PowerSeries::Reciprocal() const
+{
+    auto constant = this->GetConstant_();
+
+    if (constant.IsZero())
+    {
+        throw std::runtime_error("No power series for the reciprocal");
+    }
+
+    // 1 / (c + r) = (1 / c) * (1 - r/c + (r/c)^2 - ...)
+    // Each power of r/c raises the lowest degree, so order terms suffice.
+    auto inverse = Value(1);
+    inverse /= constant;
+
+    PowerSeries ratio =
+        (*this - PowerSeries(Polynomial(constant), this->order_)) * inverse;
+
+    PowerSeries one(Polynomial(Value(1)), this->order_);
+    PowerSeries result = one;
+    PowerSeries power = one;
+
+    for (int n = 1; n <= this->order_; ++n)
+    {
+        power = power * ratio * Value(-1);
+        result = result + power;
+    }
+
+    return result * inverse;
+}
+
+
+PowerSeries PowerSeries::Power(int exponent) const
+{
+    if (exponent < 0)
+    {
+        return this->Reciprocal().Power(-exponent);
+    }
+
+    PowerSeries result(Polynomial(Value(1)), this->order_);
+    PowerSeries base = *this;
+
+    while (exponent > 0)
+    {
+        if (exponent & 1)
+        {
+            result = result * base;
+        }
+
+        exponent >>= 1;
+
+        if (exponent > 0)
+        {
+            base = base * base;
+        }
+    }
+
+    return result;
+}
+
+
+std::ostream & PowerSeries::ToStream(std::ostream &output) const
+{
+    return this->ToSymbol()->ToStream(output)
+        << " + O(" << this->order_ + 1 << ")";
+}
+
+
+Value PowerSeries::GetConstant_() const
+{
+    const auto &terms = this->polynomial_.GetTerms();
+
+    // The constant term has the lowest degree, so it is last.
+    if (terms.empty() || !terms.back().monomial.empty())
+    {
+        return Value(0);
+    }
+
+    return terms.back().coefficient;
+}
+
+
+std::ostream & operator<<(std::ostream &output, const PowerSeries &series)
+{
+    return series.ToStream(output);
+}
+
+
+Matrix ExpandSeries(const Matrix &matrix, int order)
+{
+    SeriesExpander expander(order);
+    Matrix result(matrix.GetRowCount(), matrix.GetColumnCount());
+
+    for (size_t column = 0; column < matrix.GetColumnCount(); ++column)
+    {
+        for (size_t row = 0; row < matrix.GetRowCount(); ++row)
+        {
+            result(row, column) = expander(matrix(row, column)).ToSymbol();
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,80 @@
+/**
+  * @file power_series.h
+  *
+  * @brief Truncated multivariate power series about zero.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#pragma once
+
+#include "symbolic/polynomial.h"
+#include "symbolic/matrix.h"
+
+
+/**
+  * A Polynomial in the arguments, without any term of degree greater than
+  * the order. Every operation truncates as it goes, so a deep product never
+  * holds more than the terms that survive.
+  *
+  * Coefficients are exact rationals held in int, which limits the order to
+  * maxOrder.
+**/
+class PowerSeries
+{
+public:
+    static constexpr int maxOrder = 8;
+
+    // Zero.
+    explicit PowerSeries(int order);
+
+    PowerSeries(const Polynomial &polynomial, int order);
+
+    // The Taylor expansion about every argument equal to zero. Trig
+    // functions are expanded from sin and cos. Functions with a pole at
+    // zero (csc, cot), and non-integral powers, throw std::runtime_error.
+    static PowerSeries FromSymbol(const Symbol::Pointer &symbol, int order);
+
+    // argument must have no constant term.
+    static PowerSeries Sin(const PowerSeries &argument);
+
+    static PowerSeries Cos(const PowerSeries &argument);
+
+    int GetOrder() const;
+
+    const Polynomial & GetPolynomial() const;
+
+    S ToSymbol() const;
+
+    // The order of a result is the lower order of the operands.
+    PowerSeries operator+(const PowerSeries &other) const;
+
+    PowerSeries operator-(const PowerSeries &other) const;
+
+    PowerSeries operator*(const PowerSeries &other) const;
+
+    PowerSeries operator*(const Value &scalar) const;
+
+    // Throws std::runtime_error when the constant term is zero.
+    PowerSeries Reciprocal() const;
+
+    PowerSeries Power(int exponent) const;
+
+    std::ostream & ToStream(std::ostream &output) const;
+
+private:
+    Value GetConstant_() const;
+
+    Polynomial polynomial_;
+    int order_;
+};
+
+
+std::ostream & operator<<(std::ostream &output, const PowerSeries &series);
+
+
+// Expands each element, sharing the expansion of common subexpressions.
+Matrix ExpandSeries(const Matrix &matrix, int order);
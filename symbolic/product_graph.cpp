@@ -0,0 +1,361 @@
+/**
+  * @file product_graph.cpp
+  *
+  * @brief Implements incremental numeric matrix products.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#include "symbolic/product_graph.h"
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include "symbolic/compiled.h"
+
+
+// Argument indices, sorted.
+using Dependencies = std::vector<size_t>;
+
+
+struct ProductGraph::Node_
+{
+    size_t rows;
+    size_t columns;
+
+    // Leaves evaluate a factor.
+    std::unique_ptr<Compiled> compiled;
+
+    // The indices in ProductGraph::args_ of the arguments of compiled.
+    std::vector<size_t> argIndices;
+
+    // Internal nodes multiply two earlier nodes.
+    size_t left;
+    size_t right;
+
+    // Column-major.
+    std::vector<double> values;
+    std::vector<Dependencies> dependencies;
+
+    // Elements that are zero for any argument values.
+    std::vector<bool> isZero;
+};
+
+
+static bool Intersects(
+    const Dependencies &dependencies,
+    const std::vector<bool> &changed)
+{
+    return std::any_of(
+        std::begin(dependencies),
+        std::end(dependencies),
+        [&changed](size_t index)
+        {
+            return changed[index];
+        });
+}
+
+
+ProductGraph::ProductGraph(const std::vector<Matrix> &factors)
+    :
+    nodes_(),
+    root_(0),
+    args_(),
+    argValues_(),
+    isEvaluated_(false),
+    recomputedCount_(0)
+{
+    if (factors.empty())
+    {
+        throw std::runtime_error("Expected at least one factor");
+    }
+
+    for (size_t i = 1; i < factors.size(); ++i)
+    {
+        if (factors[i - 1].GetColumnCount() != factors[i].GetRowCount())
+        {
+            throw std::runtime_error("Incompatible dimensions");
+        }
+    }
+
+    for (const auto &factor: factors)
+    {
+        for (size_t column = 0; column < factor.GetColumnCount(); ++column)
+        {
+            for (size_t row = 0; row < factor.GetRowCount(); ++row)
+            {
+                CollectArgs(factor(row, column), this->args_);
+            }
+        }
+    }
+
+    this->argValues_.resize(this->args_.size());
+    this->root_ = this->Build_(factors, 0, factors.size() - 1);
+}
+
+
+ProductGraph::~ProductGraph() = default;
+
+
+size_t ProductGraph::GetRowCount() const
+{
+    return this->nodes_[this->root_].rows;
+}
+
+
+size_t ProductGraph::GetColumnCount() const
+{
+    return this->nodes_[this->root_].columns;
+}
+
+
+const std::vector<std::shared_ptr<Arg>> & ProductGraph::GetArgs() const
+{
+    return this->args_;
+}
+
+
+const std::vector<double> & ProductGraph::Evaluate()
+{
+    std::vector<bool> changed(this->args_.size(), false);
+
+    for (size_t i = 0; i < this->args_.size(); ++i)
+    {
+        auto value = this->args_[i]->GetValue();
+
+        if (!value)
+        {
+            throw std::runtime_error(
+                "Argument has no value: " + *this->args_[i]);
+        }
+
+        if (this->argValues_[i] != value)
+        {
+            changed[i] = true;
+            this->argValues_[i] = value;
+        }
+    }
+
+    this->recomputedCount_ = 0;
+    this->Update_(this->root_, changed);
+    this->isEvaluated_ = true;
+
+    return this->nodes_[this->root_].values;
+}
+
+
+size_t ProductGraph::GetRecomputedCount() const
+{
+    return this->recomputedCount_;
+}
+
+
+size_t ProductGraph::Build_(
+    const std::vector<Matrix> &factors,
+    size_t first,
+    size_t last)
+{
+    Node_ node{};
+
+    if (first == last)
+    {
+        const auto &factor = factors[first];
+        size_t count = factor.GetRowCount() * factor.GetColumnCount();
+
+        node.rows = factor.GetRowCount();
+        node.columns = factor.GetColumnCount();
+        node.compiled = std::make_unique<Compiled>(factor);
+        node.dependencies.resize(count);
+        node.isZero.resize(count);
+
+        for (const auto &arg: node.compiled->GetArgs())
+        {
+            auto found = std::find(
+                std::begin(this->args_),
+                std::end(this->args_),
+                arg);
+
+            node.argIndices.push_back(
+                static_cast<size_t>(
+                    std::distance(std::begin(this->args_), found)));
+        }
+
+        for (size_t column = 0; column < node.columns; ++column)
+        {
+            for (size_t row = 0; row < node.rows; ++row)
+            {
+                size_t element = column * node.rows + row;
+
+                std::vector<std::shared_ptr<Arg>> elementArgs;
+                CollectArgs(factor(row, column), elementArgs);
+
+                auto &dependencies = node.dependencies[element];
+
+                for (const auto &arg: elementArgs)
+                {
+                    auto found = std::find(
+                        std::begin(this->args_),
+                        std::end(this->args_),
+                        arg);
+
+                    dependencies.push_back(
+                        static_cast<size_t>(
+                            std::distance(std::begin(this->args_), found)));
+                }
+
+                std::sort(std::begin(dependencies), std::end(dependencies));
+
+                node.isZero[element] =
+                    (factor.GetStructure(row, column) == Structure::zero);
+            }
+        }
+    }
+    else
+    {
+        size_t middle = first + (last - first) / 2;
+
+        node.left = this->Build_(factors, first, middle);
+        node.right = this->Build_(factors, middle + 1, last);
+
+        const auto &left = this->nodes_[node.left];
+        const auto &right = this->nodes_[node.right];
+
+        node.rows = left.rows;
+        node.columns = right.columns;
+
+        size_t count = node.rows * node.columns;
+        size_t inner = left.columns;
+
+        node.dependencies.resize(count);
+        node.isZero.resize(count, true);
+
+        for (size_t column = 0; column < node.columns; ++column)
+        {
+            for (size_t row = 0; row < node.rows; ++row)
+            {
+                size_t element = column * node.rows + row;
+                auto &dependencies = node.dependencies[element];
+
+                for (size_t i = 0; i < inner; ++i)
+                {
+                    size_t leftElement = i * left.rows + row;
+                    size_t rightElement = column * inner + i;
+
+                    if (left.isZero[leftElement] || right.isZero[rightElement])
+                    {
+                        continue;
+                    }
+
+                    node.isZero[element] = false;
+
+                    Dependencies merged;
+
+                    std::set_union(
+                        std::begin(dependencies),
+                        std::end(dependencies),
+                        std::begin(left.dependencies[leftElement]),
+                        std::end(left.dependencies[leftElement]),
+                        std::back_inserter(merged));
+
+                    dependencies.clear();
+
+                    std::set_union(
+                        std::begin(merged),
+                        std::end(merged),
+                        std::begin(right.dependencies[rightElement]),
+                        std::end(right.dependencies[rightElement]),
+                        std::back_inserter(dependencies));
+                }
+            }
+        }
+    }
+
+    // Every element is computed by the first evaluation, including the
+    // constants, which are never computed again.
+    node.values.resize(node.rows * node.columns, 0.0);
+    this->nodes_.push_back(std::move(node));
+
+    return this->nodes_.size() - 1;
+}
+
+
+void ProductGraph::Update_(size_t index, const std::vector<bool> &changed)
+{
+    auto &node = this->nodes_[index];
+
+    if (node.compiled)
+    {
+        bool isChanged = std::any_of(
+            std::begin(node.argIndices),
+            std::end(node.argIndices),
+            [&changed](size_t argIndex)
+            {
+                return changed[argIndex];
+            });
+
+        if (!isChanged && this->isEvaluated_)
+        {
+            return;
+        }
+
+        std::vector<double> argValues;
+        argValues.reserve(node.argIndices.size());
+
+        for (auto argIndex: node.argIndices)
+        {
+            argValues.push_back(*this->argValues_[argIndex]);
+        }
+
+        node.values = node.compiled->Evaluate(argValues);
+        this->recomputedCount_ += node.values.size();
+
+        return;
+    }
+
+    this->Update_(node.left, changed);
+    this->Update_(node.right, changed);
+
+    const auto &left = this->nodes_[node.left];
+    const auto &right = this->nodes_[node.right];
+    size_t inner = left.columns;
+
+    for (size_t column = 0; column < node.columns; ++column)
+    {
+        for (size_t row = 0; row < node.rows; ++row)
+        {
+            size_t element = column * node.rows + row;
+
+            if (node.isZero[element])
+            {
+                continue;
+            }
+
+            if (this->isEvaluated_
+                    && !Intersects(node.dependencies[element], changed))
+            {
+                continue;
+            }
+
+            double sum = 0.0;
+
+            for (size_t i = 0; i < inner; ++i)
+            {
+                size_t leftElement = i * left.rows + row;
+                size_t rightElement = column * inner + i;
+
+                if (left.isZero[leftElement] || right.isZero[rightElement])
+                {
+                    continue;
+                }
+
+                sum += left.values[leftElement] * right.values[rightElement];
+            }
+
+            node.values[element] = sum;
+            ++this->recomputedCount_;
+        }
+    }
+}
@@ -0,0 +1,69 @@
+/**
+  * @file product_graph.h
+  *
+  * @brief Numeric matrix products that recompute only what changed.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+#include "symbolic/matrix.h"
+
+
+/**
+  * Evaluates a product of matrices with the values set on each Arg, and
+  * remembers every partial product. The factors are grouped as a balanced
+  * tree, so a change to the arguments of one factor reaches the result
+  * through a logarithmic count of partial products.
+  *
+  * Each element of each partial product records the arguments it depends
+  * on. After some arguments change, only the elements that depend on them
+  * are recomputed; the rest are kept from the previous evaluation.
+**/
+class ProductGraph
+{
+public:
+    explicit ProductGraph(const std::vector<Matrix> &factors);
+
+    ~ProductGraph();
+
+    size_t GetRowCount() const;
+
+    size_t GetColumnCount() const;
+
+    // Every argument of the factors, in order of appearance.
+    const std::vector<std::shared_ptr<Arg>> & GetArgs() const;
+
+    // The product in column-major order, after recomputing the elements
+    // that depend on arguments changed since the previous evaluation.
+    // Throws std::runtime_error when an argument has no value.
+    const std::vector<double> & Evaluate();
+
+    // The count of elements, over all partial products, recomputed by the
+    // last evaluation.
+    size_t GetRecomputedCount() const;
+
+private:
+    struct Node_;
+
+    size_t Build_(
+        const std::vector<Matrix> &factors,
+        size_t first,
+        size_t last);
+
+    void Update_(size_t index, const std::vector<bool> &changed);
+
+    std::vector<Node_> nodes_;
+    size_t root_;
+    std::vector<std::shared_ptr<Arg>> args_;
+    std::vector<std::optional<double>> argValues_;
+    bool isEvaluated_;
+    size_t recomputedCount_;
+};
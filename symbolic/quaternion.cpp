@@ -0,0 +1,278 @@
+/**
+  * @file quaternion.cpp
+  *
+  * @brief Implements symbolic quaternions.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#include "symbolic/quaternion.h"
+
+#include <initializer_list>
+#include <tuple>
+
+
+struct Product
+{
+    int coefficient;
+    S left;
+    S right;
+};
+
+
+// Sums coefficient * left * right, skipping structural zeros and ones.
+static S Sum(std::initializer_list<Product> products)
+{
+    S result;
+
+    for (const auto &[coefficient, left, right]: products)
+    {
+        auto leftStructure = GetStructure(left);
+        auto rightStructure = GetStructure(right);
+
+        if (leftStructure == Structure::zero
+                || rightStructure == Structure::zero)
+        {
+            continue;
+        }
+
+        S product;
+
+        if (leftStructure == Structure::one)
+        {
+            product = right;
+        }
+        else if (rightStructure == Structure::one)
+        {
+            product = left;
+        }
+        else
+        {
+            product = left * right;
+        }
+
+        if (coefficient != 1)
+        {
+            product = S(coefficient) * product;
+        }
+
+        if (result)
+        {
+            result = result + product;
+        }
+        else
+        {
+            result = product;
+        }
+    }
+
+    if (!result)
+    {
+        return S(0);
+    }
+
+    return result;
+}
+
+
+static S HalfSine(const std::string &arg)
+{
+    auto half = Arg::GetFraction(arg, 2);
+
+    return S("sin", *half);
+}
+
+
+static S HalfCosine(const std::string &arg)
+{
+    auto half = Arg::GetFraction(arg, 2);
+
+    return S("cos", *half);
+}
+
+
+Quaternion::Quaternion()
+    :
+    Quaternion(S(1), S(0), S(0), S(0), true)
+{
+
+}
+
+
+Quaternion::Quaternion(const S &w, const S &x, const S &y, const S &z)
+    :
+    Quaternion(w, x, y, z, false)
+{
+
+}
+
+
+Quaternion::Quaternion(
+    const S &w,
+    const S &x,
+    const S &y,
+    const S &z,
+    bool isUnit)
+    :
+    w_(w),
+    x_(x),
+    y_(y),
+    z_(z),
+    isUnit_(isUnit)
+{
+
+}
+
+
+Quaternion Quaternion::AboutX(const std::string &arg)
+{
+    return Quaternion(HalfCosine(arg), HalfSine(arg), S(0), S(0), true);
+}
+
+
+Quaternion Quaternion::AboutY(const std::string &arg)
+{
+    return Quaternion(HalfCosine(arg), S(0), HalfSine(arg), S(0), true);
+}
+
+
+Quaternion Quaternion::AboutZ(const std::string &arg)
+{
+    return Quaternion(HalfCosine(arg), S(0), S(0), HalfSine(arg), true);
+}
+
+
+Quaternion Quaternion::FromAxisAngle(
+    const S &x,
+    const S &y,
+    const S &z,
+    const std::string &arg)
+{
+    auto sine = HalfSine(arg);
+
+    return Quaternion(
+        HalfCosine(arg),
+        Sum({{1, x, sine}}),
+        Sum({{1, y, sine}}),
+        Sum({{1, z, sine}}),
+        true);
+}
+
+
+Quaternion Quaternion::operator*(const Quaternion &other) const
+{
+    const auto &[w, x, y, z] =
+        std::tie(this->w_, this->x_, this->y_, this->z_);
+
+    const auto &[ow, ox, oy, oz] =
+        std::tie(other.w_, other.x_, other.y_, other.z_);
+
+    return Quaternion(
+        Sum({{1, w, ow}, {-1, x, ox}, {-1, y, oy}, {-1, z, oz}}),
+        Sum({{1, w, ox}, {1, x, ow}, {1, y, oz}, {-1, z, oy}}),
+        Sum({{1, w, oy}, {-1, x, oz}, {1, y, ow}, {1, z, ox}}),
+        Sum({{1, w, oz}, {1, x, oy}, {-1, y, ox}, {1, z, ow}}),
+        this->isUnit_ && other.isUnit_);
+}
+
+
+Quaternion Quaternion::Conjugate() const
+{
+    return Quaternion(
+        this->w_,
+        Sum({{-1, this->x_, S(1)}}),
+        Sum({{-1, this->y_, S(1)}}),
+        Sum({{-1, this->z_, S(1)}}),
+        this->isUnit_);
+}
+
+
+const S & Quaternion::GetW() const
+{
+    return this->w_;
+}
+
+
+const S & Quaternion::GetX() const
+{
+    return this->x_;
+}
+
+
+const S & Quaternion::GetY() const
+{
+    return this->y_;
+}
+
+
+const S & Quaternion::GetZ() const
+{
+    return this->z_;
+}
+
+
+bool Quaternion::IsUnit() const
+{
+    return this->isUnit_;
+}
+
+
+Matrix Quaternion::ToMatrix() const
+{
+    const auto &[w, x, y, z] =
+        std::tie(this->w_, this->x_, this->y_, this->z_);
+
+    Matrix result(3, 3);
+
+    if (this->isUnit_)
+    {
+        // w^2 + x^2 + y^2 + z^2 = 1 eliminates the squares of w.
+        result.Assign(
+            Sum({{1, S(1), S(1)}, {-2, y, y}, {-2, z, z}}),
+            Sum({{2, x, y}, {-2, w, z}}),
+            Sum({{2, x, z}, {2, w, y}}),
+
+            Sum({{2, x, y}, {2, w, z}}),
+            Sum({{1, S(1), S(1)}, {-2, x, x}, {-2, z, z}}),
+            Sum({{2, y, z}, {-2, w, x}}),
+
+            Sum({{2, x, z}, {-2, w, y}}),
+            Sum({{2, y, z}, {2, w, x}}),
+            Sum({{1, S(1), S(1)}, {-2, x, x}, {-2, y, y}}));
+
+        result.SetOrthogonality(Orthogonality::rotation);
+
+        return result;
+    }
+
+    result.Assign(
+        Sum({{1, w, w}, {1, x, x}, {-1, y, y}, {-1, z, z}}),
+        Sum({{2, x, y}, {-2, w, z}}),
+        Sum({{2, x, z}, {2, w, y}}),
+
+        Sum({{2, x, y}, {2, w, z}}),
+        Sum({{1, w, w}, {-1, x, x}, {1, y, y}, {-1, z, z}}),
+        Sum({{2, y, z}, {-2, w, x}}),
+
+        Sum({{2, x, z}, {-2, w, y}}),
+        Sum({{2, y, z}, {2, w, x}}),
+        Sum({{1, w, w}, {-1, x, x}, {-1, y, y}, {1, z, z}}));
+
+    return result;
+}
+
+
+std::ostream & Quaternion::ToStream(std::ostream &output) const
+{
+    return output << "[" << this->w_ << ", " << this->x_ << ", "
+        << this->y_ << ", " << this->z_ << "]";
+}
+
+
+std::ostream & operator<<(std::ostream &output, const Quaternion &quaternion)
+{
+    return quaternion.ToStream(output);
+}
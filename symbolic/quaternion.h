@@ -0,0 +1,84 @@
+/**
+  * @file quaternion.h
+  *
+  * @brief Symbolic quaternions for composing rotations.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#pragma once
+
+#include <string>
+#include "symbolic/symbol.h"
+#include "symbolic/matrix.h"
+
+
+/**
+  * A rotation by angle θ about a unit axis is the quaternion
+  * cos(θ/2) + sin(θ/2) (x i + y j + z k). Composing rotations with the
+  * Hamilton product takes 16 symbolic multiplications instead of the 27 of a
+  * 3x3 matrix product, so long chains should be composed as quaternions and
+  * converted with ToMatrix at the end.
+  *
+  * The half angles are fractional Args (see Arg::GetFraction), so the
+  * elements of the matrix are written in terms of θ/2.
+**/
+class Quaternion
+{
+public:
+    // The identity rotation.
+    Quaternion();
+
+    Quaternion(const S &w, const S &x, const S &y, const S &z);
+
+    static Quaternion AboutX(const std::string &arg);
+
+    static Quaternion AboutY(const std::string &arg);
+
+    static Quaternion AboutZ(const std::string &arg);
+
+    // The axis (x, y, z) must have unit length.
+    static Quaternion FromAxisAngle(
+        const S &x,
+        const S &y,
+        const S &z,
+        const std::string &arg);
+
+    // The Hamilton product. Applying the result rotates by other first.
+    Quaternion operator*(const Quaternion &other) const;
+
+    Quaternion Conjugate() const;
+
+    const S & GetW() const;
+
+    const S & GetX() const;
+
+    const S & GetY() const;
+
+    const S & GetZ() const;
+
+    // True when built from unit quaternions, and so a pure rotation.
+    bool IsUnit() const;
+
+    // The 3x3 rotation matrix. A unit quaternion produces a matrix tagged
+    // Orthogonality::rotation. Otherwise, the homogeneous form is used, and
+    // the matrix is scaled by the squared norm.
+    Matrix ToMatrix() const;
+
+    std::ostream & ToStream(std::ostream &output) const;
+
+private:
+    Quaternion(const S &w, const S &x, const S &y, const S &z, bool isUnit);
+
+    S w_;
+    S x_;
+    S y_;
+    S z_;
+    bool isUnit_;
+};
+
+
+std::ostream & operator<<(std::ostream &output, const Quaternion &quaternion);
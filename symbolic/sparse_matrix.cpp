@@ -0,0 +1,199 @@
+/**
+  * @file sparse_matrix.cpp
+  *
+  * @brief Implements the sparse symbolic matrix.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#include "symbolic/sparse_matrix.h"
+
+#include <stdexcept>
+
+
+SparseMatrix::SparseMatrix(size_t rows, size_t columns)
+    :
+    rows_(rows),
+    columns_(columns),
+    values_(columns)
+{
+
+}
+
+SparseMatrix::SparseMatrix(const Matrix &matrix)
+    :
+    rows_(matrix.GetRowCount()),
+    columns_(matrix.GetColumnCount()),
+    values_(matrix.GetColumnCount())
+{
+    for (size_t column = 0; column < this->columns_; ++column)
+    {
+        for (size_t row = 0; row < this->rows_; ++row)
+        {
+            if (matrix.GetStructure(row, column) != Structure::zero)
+            {
+                this->values_[column].emplace(row, matrix(row, column));
+            }
+        }
+    }
+}
+
+S SparseMatrix::Get(size_t row, size_t column) const
+{
+    if (row >= this->rows_)
+    {
+        throw std::out_of_range("row out of range");
+    }
+
+    const auto &columnValues = this->values_.at(column);
+    auto found = columnValues.find(row);
+
+    if (found == std::end(columnValues))
+    {
+        return S(0);
+    }
+
+    return found->second;
+}
+
+void SparseMatrix::Set(size_t row, size_t column, const S &value)
+{
+    if (row >= this->rows_)
+    {
+        throw std::out_of_range("row out of range");
+    }
+
+    auto &columnValues = this->values_.at(column);
+
+    if (GetStructure(value) == Structure::zero)
+    {
+        columnValues.erase(row);
+    }
+    else
+    {
+        columnValues[row] = value;
+    }
+}
+
+SparseMatrix SparseMatrix::operator*(const SparseMatrix &other) const
+{
+    if (this->columns_ != other.rows_)
+    {
+        throw std::runtime_error("Incompatible dimensions");
+    }
+
+    SparseMatrix result(this->rows_, other.columns_);
+
+    for (size_t column = 0; column < other.columns_; ++column)
+    {
+        auto &resultColumn = result.values_[column];
+
+        // Visit the stored elements in order of the inner index so that each
+        // result element accumulates its terms in the same order as
+        // Matrix::operator*.
+        for (const auto &[inner, right]: other.values_[column])
+        {
+            bool rightIsOne = (GetStructure(right) == Structure::one);
+
+            for (const auto &[row, left]: this->values_[inner])
+            {
+                S product;
+
+                if (rightIsOne)
+                {
+                    product = left;
+                }
+                else if (GetStructure(left) == Structure::one)
+                {
+                    product = right;
+                }
+                else
+                {
+                    product = left * right;
+                }
+
+                auto found = resultColumn.find(row);
+
+                if (found == std::end(resultColumn))
+                {
+                    resultColumn.emplace(row, product);
+                }
+                else
+                {
+                    found->second = found->second + product;
+                }
+            }
+        }
+
+        // Products may have cancelled.
+        for (auto it = std::begin(resultColumn); it != std::end(resultColumn);)
+        {
+            if (GetStructure(it->second) == Structure::zero)
+            {
+                it = resultColumn.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    return result;
+}
+
+size_t SparseMatrix::GetRowCount() const
+{
+    return this->rows_;
+}
+
+size_t SparseMatrix::GetColumnCount() const
+{
+    return this->columns_;
+}
+
+size_t SparseMatrix::GetNonZeroCount() const
+{
+    size_t count = 0;
+
+    for (const auto &columnValues: this->values_)
+    {
+        count += columnValues.size();
+    }
+
+    return count;
+}
+
+Matrix SparseMatrix::ToMatrix() const
+{
+    Matrix result(this->rows_, this->columns_);
+
+    for (size_t column = 0; column < this->columns_; ++column)
+    {
+        for (size_t row = 0; row < this->rows_; ++row)
+        {
+            result(row, column) = S(0);
+        }
+
+        for (const auto &[row, value]: this->values_[column])
+        {
+            result(row, column) = value;
+        }
+    }
+
+    return result;
+}
+
+std::ostream & SparseMatrix::ToStream(std::ostream &output) const
+{
+    return this->ToMatrix().ToStream(output);
+}
+
+
+std::ostream & operator<<(std::ostream &output, const SparseMatrix &matrix)
+{
+    return matrix.ToStream(output);
+}
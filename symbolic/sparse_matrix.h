@@ -0,0 +1,56 @@
+/**
+  * @file sparse_matrix.h
+  *
+  * @brief A symbolic matrix that stores only its structural non-zeros.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#pragma once
+
+#include <map>
+#include <vector>
+#include "symbol.h"
+#include "matrix.h"
+
+
+class SparseMatrix
+{
+public:
+    SparseMatrix(size_t rows, size_t columns);
+
+    explicit SparseMatrix(const Matrix &matrix);
+
+    // Returns S(0) for elements that are not stored.
+    S Get(size_t row, size_t column) const;
+
+    // Storing a structural zero removes the element.
+    void Set(size_t row, size_t column, const S &value);
+
+    SparseMatrix operator*(const SparseMatrix &other) const;
+
+    size_t GetRowCount() const;
+
+    size_t GetColumnCount() const;
+
+    size_t GetNonZeroCount() const;
+
+    Matrix ToMatrix() const;
+
+    std::ostream & ToStream(std::ostream &output) const;
+
+private:
+    size_t rows_;
+    size_t columns_;
+
+    // Column-major, like Matrix. Each column maps row index to element.
+    using Column = std::map<size_t, S>;
+
+    std::vector<Column> values_;
+};
+
+
+std::ostream & operator<<(std::ostream &output, const SparseMatrix &matrix);
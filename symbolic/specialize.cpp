@@ -0,0 +1,394 @@
+/**
+  * @file specialize.cpp
+  *
+  * @brief Implements partial evaluation.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#include "symbolic/specialize.h"
+
+#include <cassert>
+#include <numeric>
+#include <stdexcept>
+#include "symbolic/expression.h"
+#include "symbolic/named.h"
+
+
+using Pointer = typename Symbol::Pointer;
+
+
+Bindings & Bindings::BindAngle(
+    const std::string &arg,
+    int numerator,
+    int denominator)
+{
+    if (denominator == 0)
+    {
+        throw std::runtime_error("Divide by zero");
+    }
+
+    if (denominator < 0)
+    {
+        numerator = -numerator;
+        denominator = -denominator;
+    }
+
+    int divisor = std::gcd(numerator, denominator);
+
+    this->values_.erase(arg);
+    this->angles_[arg] = {numerator / divisor, denominator / divisor};
+
+    return *this;
+}
+
+
+Bindings & Bindings::BindValue(const std::string &arg, const Value &value)
+{
+    if (value.HasPower())
+    {
+        throw std::runtime_error("Expected a rational value");
+    }
+
+    this->angles_.erase(arg);
+    this->values_.insert_or_assign(arg, value);
+
+    return *this;
+}
+
+
+std::optional<PiMultiple> Bindings::GetAngle(const Arg &arg) const
+{
+    if (auto parent = arg.GetParent())
+    {
+        auto parentAngle = this->GetAngle(*parent);
+
+        if (!parentAngle)
+        {
+            return {};
+        }
+
+        int numerator = parentAngle->numerator;
+        int denominator = parentAngle->denominator * arg.GetDivisor();
+        int divisor = std::gcd(numerator, denominator);
+
+        return PiMultiple{numerator / divisor, denominator / divisor};
+    }
+
+    auto found = this->angles_.find(arg);
+
+    if (found == std::end(this->angles_))
+    {
+        return {};
+    }
+
+    return PiMultiple{found->second.first, found->second.second};
+}
+
+
+std::optional<Value> Bindings::GetValue(const Arg &arg) const
+{
+    if (auto parent = arg.GetParent())
+    {
+        auto parentValue = this->GetValue(*parent);
+
+        if (!parentValue)
+        {
+            return {};
+        }
+
+        *parentValue /= Value(arg.GetDivisor());
+
+        return parentValue;
+    }
+
+    auto found = this->values_.find(arg);
+
+    if (found == std::end(this->values_))
+    {
+        return {};
+    }
+
+    return found->second;
+}
+
+
+bool Bindings::IsEmpty() const
+{
+    return this->angles_.empty() && this->values_.empty();
+}
+
+
+bool Bindings::operator<(const Bindings &other) const
+{
+    if (this->angles_ != other.angles_)
+    {
+        return this->angles_ < other.angles_;
+    }
+
+    return std::lexicographical_compare(
+        std::begin(this->values_),
+        std::end(this->values_),
+        std::begin(other.values_),
+        std::end(other.values_),
+        [](const auto &left, const auto &right)
+        {
+            if (left.first != right.first)
+            {
+                return left.first < right.first;
+            }
+
+            return left.second < right.second;
+        });
+}
+
+
+// The value of a plain named term when its argument is value.
+static std::optional<Value> RaiseValue(const Named *named, const Value &value)
+{
+    // Hold the pointers, which are copies.
+    auto powerPointer = named->GetPower();
+    auto scalarPointer = named->GetScalar();
+    auto power = dynamic_cast<const Value *>(powerPointer.get());
+    auto scalar = dynamic_cast<const Value *>(scalarPointer.get());
+
+    assert(power);
+    assert(scalar);
+
+    if (!power->IsIntegral())
+    {
+        return {};
+    }
+
+    int exponent = power->GetIntegral();
+    Value base = value;
+
+    if (exponent < 0)
+    {
+        if (value.IsZero())
+        {
+            return {};
+        }
+
+        base = Value(1);
+        base /= value;
+        exponent = -exponent;
+    }
+
+    auto result = *scalar;
+
+    while (exponent-- > 0)
+    {
+        result *= base;
+    }
+
+    return result;
+}
+
+
+// Specializes each node once, so that shared subexpressions stay shared.
+class Substitution
+{
+public:
+    explicit Substitution(const Bindings &bindings)
+        :
+        bindings_(bindings),
+        memo_()
+    {
+
+    }
+
+    S operator()(const Pointer &symbol)
+    {
+        auto found = this->memo_.find(symbol.get());
+
+        if (found != std::end(this->memo_))
+        {
+            return found->second.second;
+        }
+
+        auto result = this->Substitute_(symbol);
+        this->memo_.emplace(symbol.get(), std::make_pair(symbol, result));
+
+        return result;
+    }
+
+private:
+    S Substitute_(const Pointer &symbol)
+    {
+        if (symbol->IsValue())
+        {
+            return symbol;
+        }
+
+        if (symbol->IsNamed())
+        {
+            return this->SubstituteNamed_(symbol);
+        }
+
+        auto expression = dynamic_cast<const Expression *>(symbol.get());
+
+        if (!expression)
+        {
+            throw std::runtime_error("Unsupported symbol");
+        }
+
+        auto left = (*this)(expression->GetLeft());
+        auto right = (*this)(expression->GetRight());
+        auto scalar = (*this)(expression->GetScalar());
+        auto power = (*this)(expression->GetPower());
+
+        if (left == expression->GetLeft()
+                && right == expression->GetRight()
+                && scalar == expression->GetScalar()
+                && power == expression->GetPower())
+        {
+            // Nothing below this node is bound.
+            return symbol;
+        }
+
+        S result;
+
+        switch (expression->GetOp())
+        {
+            case Op::add:
+                result = left + right;
+                break;
+
+            case Op::subtract:
+                result = left - right;
+                break;
+
+            case Op::multiply:
+                result = left * right;
+                break;
+
+            case Op::divide:
+                result = left / right;
+                break;
+
+            default:
+                throw std::logic_error("Invalid operator");
+        }
+
+        if (!power->IsOne())
+        {
+            result = result ^ power;
+        }
+
+        if (!scalar->IsOne())
+        {
+            result = scalar * result;
+        }
+
+        return result;
+    }
+
+    S SubstituteNamed_(const Pointer &symbol)
+    {
+        auto named = dynamic_cast<const Named *>(symbol.get());
+        assert(named);
+
+        const auto &symbolName = named->GetSymbolName();
+        const auto &arg = *symbolName.GetArg();
+
+        std::optional<Value> result;
+
+        if (symbolName.IsTrig())
+        {
+            auto angle = this->bindings_.GetAngle(arg);
+
+            if (!angle)
+            {
+                return symbol;
+            }
+
+            auto exact = GetExactTrigValue(symbolName.GetFunction(), *angle);
+
+            if (!exact)
+            {
+                return symbol;
+            }
+
+            result = named->GetExactValue(*exact);
+        }
+        else if (auto value = this->bindings_.GetValue(arg))
+        {
+            result = RaiseValue(named, *value);
+        }
+
+        if (!result)
+        {
+            return symbol;
+        }
+
+        return S(std::make_shared<Value>(*result));
+    }
+
+    const Bindings &bindings_;
+    std::map<const Symbol *, std::pair<Pointer, S>> memo_;
+};
+
+
+S Specialize(const S &symbol, const Bindings &bindings)
+{
+    return Substitution(bindings)(symbol);
+}
+
+
+Matrix Specialize(const Matrix &matrix, const Bindings &bindings)
+{
+    Substitution substitution(bindings);
+    Matrix result(matrix.GetRowCount(), matrix.GetColumnCount());
+
+    for (size_t column = 0; column < matrix.GetColumnCount(); ++column)
+    {
+        for (size_t row = 0; row < matrix.GetRowCount(); ++row)
+        {
+            result(row, column) = substitution(matrix(row, column));
+        }
+    }
+
+    result.SetOrthogonality(matrix.GetOrthogonality());
+
+    return result;
+}
+
+
+Specializer::Specializer(const Matrix &matrix)
+    :
+    matrix_(matrix),
+    cache_()
+{
+
+}
+
+
+const Matrix & Specializer::operator()(const Bindings &bindings)
+{
+    auto found = this->cache_.find(bindings);
+
+    if (found != std::end(this->cache_))
+    {
+        return found->second;
+    }
+
+    return this->cache_.emplace(
+        bindings,
+        Specialize(this->matrix_, bindings)).first->second;
+}
+
+
+const Matrix & Specializer::GetMatrix() const
+{
+    return this->matrix_;
+}
+
+
+size_t Specializer::GetCacheSize() const
+{
+    return this->cache_.size();
+}
@@ -0,0 +1,81 @@
+/**
+  * @file specialize.h
+  *
+  * @brief Partial evaluation of symbols under exact argument values.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <utility>
+#include "symbolic/matrix.h"
+#include "symbolic/value.h"
+
+
+/**
+  * Exact values for some of the arguments, independent of the values set
+  * on the Args themselves. A fractional argument such as α/2 follows the
+  * binding of its parent.
+**/
+class Bindings
+{
+public:
+    // Binds arg to the angle numerator * π / denominator.
+    Bindings & BindAngle(const std::string &arg, int numerator, int denominator);
+
+    // Binds a plain argument to an exact value.
+    Bindings & BindValue(const std::string &arg, const Value &value);
+
+    std::optional<PiMultiple> GetAngle(const Arg &arg) const;
+
+    std::optional<Value> GetValue(const Arg &arg) const;
+
+    bool IsEmpty() const;
+
+    bool operator<(const Bindings &other) const;
+
+private:
+    std::map<std::string, std::pair<int, int>> angles_;
+    std::map<std::string, Value> values_;
+};
+
+
+/**
+  * Substitutes the bound arguments and folds the constants. Trig functions
+  * of bound angles fold when their values are rational (see
+  * GetExactTrigValue). The residual is in terms of the unbound arguments.
+  * Subexpressions that do not depend on a binding are shared, not copied.
+**/
+S Specialize(const S &symbol, const Bindings &bindings);
+
+
+Matrix Specialize(const Matrix &matrix, const Bindings &bindings);
+
+
+/**
+  * Remembers the specializations of one Matrix, so that returning to a
+  * binding is a lookup. The matrix is computed once with its arguments
+  * free, and each new binding is a substitution instead of a
+  * recomputation.
+**/
+class Specializer
+{
+public:
+    explicit Specializer(const Matrix &matrix);
+
+    const Matrix & operator()(const Bindings &bindings);
+
+    const Matrix & GetMatrix() const;
+
+    size_t GetCacheSize() const;
+
+private:
+    Matrix matrix_;
+    std::map<Bindings, Matrix> cache_;
+};
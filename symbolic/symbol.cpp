@@ -9,9 +9,13 @@
   * Licensed under the MIT license. See LICENSE file.
 **/
 
+#include <cmath>
 #include <locale>
+#include <numeric>
 #include <jive/strings.h>
 
+#include "context.h"
+#include "frame.h"
 #include "settings.h"
 #include "symbol.h"
 #include "named.h"
@@ -228,148 +232,427 @@ bool operator<(typename Symbol::Pointer left, typename Symbol::Pointer right)
 }
 
 
-std::map<std::string, std::shared_ptr<Arg>> args_;
+// Greek letters sort alphabetically after every Latin name. Other names
+// sort by their first eight bytes.
+static uint64_t MakeSortKey(const std::string &name)
+{
+    if (greek::IsGreek(name))
+    {
+        return (uint64_t{0xFF} << 56)
+            | static_cast<uint64_t>(greek::sortOrder.at(name));
+    }
+
+    uint64_t key = 0;
+
+    for (size_t i = 0; i < 8; ++i)
+    {
+        key <<= 8;
+
+        if (i < name.size())
+        {
+            key |= static_cast<uint8_t>(name[i]);
+        }
+    }
+
+    return key;
+}
+
+
+Arg::Arg(const std::string &name, uint32_t id)
+    :
+    std::string(name),
+    value_(),
+    piMultiple_(),
+    parent_(),
+    divisor_(1),
+    id_(id),
+    sortKey_(MakeSortKey(name)),
+    version_(1),
+    derived_()
+{
+    this->InitializeDerived_();
+}
 
 
-Arg::Arg(const std::string &name)
+Arg::Arg(
+    const std::string &name,
+    uint32_t id,
+    const std::shared_ptr<Arg> &parent,
+    int divisor)
     :
-    std::string(name)
+    std::string(name),
+    value_(),
+    piMultiple_(),
+    parent_(parent),
+    divisor_(divisor),
+    id_(id),
+    sortKey_(MakeSortKey(name)),
+    version_(1),
+    derived_()
+{
+    this->InitializeDerived_();
+}
+
+
+void Arg::InitializeDerived_()
+{
+    if (this->GetValue())
+    {
+        return;
+    }
+
+    // Without a value there is nothing to derive, so the empty values are
+    // already current. Reading them then never writes to the argument.
+    for (auto &derived: this->derived_)
+    {
+        derived.version = this->GetVersion();
+    }
+}
+
+
+const Arg::Derived_ & Arg::GetDerived_(Trig function) const
 {
+    auto &derived = this->derived_[static_cast<size_t>(function)];
+    auto version = this->GetVersion();
+
+    if (derived.version == version)
+    {
+        return derived;
+    }
+
+    derived.version = version;
+    derived.exact.reset();
+    derived.value = this->GetValue();
+
+    if (function == Trig::none || !derived.value)
+    {
+        return derived;
+    }
+
+    if (auto angle = this->GetPiMultiple())
+    {
+        derived.exact = GetExactTrigValue(function, *angle);
+    }
+
+    if (derived.exact)
+    {
+        derived.value = derived.exact->GetValue();
+    }
+    else
+    {
+        derived.value = GetTrigValue(function, *derived.value);
+    }
 
+    return derived;
+}
+
+
+void Arg::UpdateDerived_() const
+{
+    for (size_t i = 0; i < this->derived_.size(); ++i)
+    {
+        this->GetDerived_(static_cast<Trig>(i));
+    }
 }
 
 
 void Arg::ClearValue()
 {
+    if (this->parent_)
+    {
+        throw std::logic_error("A fractional argument follows its parent");
+    }
+
     this->value_.reset();
+    this->piMultiple_.reset();
+    ++this->version_;
 }
 
 
 void Arg::SetValue(double value)
 {
+    if (this->parent_)
+    {
+        throw std::logic_error("A fractional argument follows its parent");
+    }
+
     this->value_ = value;
+    this->piMultiple_.reset();
+    ++this->version_;
 }
 
 
 std::optional<double> Arg::GetValue() const
 {
+    if (this->parent_)
+    {
+        auto parentValue = this->parent_->GetValue();
+
+        if (!parentValue)
+        {
+            return {};
+        }
+
+        return *parentValue / this->divisor_;
+    }
+
     return this->value_;
 }
 
 
-std::shared_ptr<Arg> Arg::CreateShared_(const std::string &name)
+static const double pi = std::acos(-1.0);
+
+
+static PiMultiple MakePiMultiple(int numerator, int denominator)
 {
-    auto arg = new Arg(name);
+    if (denominator == 0)
+    {
+        throw std::runtime_error("Divide by zero");
+    }
 
-    try
+    if (denominator < 0)
     {
-        return std::shared_ptr<Arg>(arg);
+        numerator = -numerator;
+        denominator = -denominator;
     }
-    catch (...)
+
+    int divisor = std::gcd(numerator, denominator);
+
+    return {numerator / divisor, denominator / divisor};
+}
+
+
+void Arg::SetPiMultiple(int numerator, int denominator)
+{
+    if (this->parent_)
     {
-        delete arg;
-        throw;
+        throw std::logic_error("A fractional argument follows its parent");
     }
+
+    auto angle = MakePiMultiple(numerator, denominator);
+    this->value_ = pi * angle.numerator / angle.denominator;
+    this->piMultiple_ = angle;
+    ++this->version_;
 }
 
 
-std::shared_ptr<Arg> Arg::Get(const std::string &name)
+std::optional<PiMultiple> Arg::GetPiMultiple() const
 {
-    if (args_.count(name))
+    if (this->parent_)
     {
-        return args_[name];
+        auto parentAngle = this->parent_->GetPiMultiple();
+
+        if (!parentAngle)
+        {
+            return {};
+        }
+
+        return MakePiMultiple(
+            parentAngle->numerator,
+            parentAngle->denominator * this->divisor_);
     }
 
-    args_[name] = Arg::CreateShared_(name);
+    return this->piMultiple_;
+}
+
 
-    return args_[name];
+std::shared_ptr<Arg> Arg::CreateShared_(const std::string &name, uint32_t id)
+{
+    return std::shared_ptr<Arg>(new Arg(name, id));
 }
 
 
-static const std::vector<std::string> trigNames
-    {"sin", "cos", "tan", "sec", "csc", "cot"};
+std::shared_ptr<Arg> Arg::CreateShared_(
+    const std::string &name,
+    uint32_t id,
+    const std::shared_ptr<Arg> &parent,
+    int divisor)
+{
+    return std::shared_ptr<Arg>(new Arg(name, id, parent, divisor));
+}
 
 
-static const std::map<std::string, int> trigSortOrder{
-    {"sin", 0},
-    {"cos", 1},
-    {"tan", 2},
-    {"sec", 3},
-    {"csc", 4},
-    {"cot", 5}
-};
+std::shared_ptr<Arg> Arg::Get(std::string_view name)
+{
+    return Context::GetCurrent().GetArg(name);
+}
 
 
-static const std::map<std::string, std::string> shortTrigNames{
-    {"sin", "s"},
-    {"cos", "c"},
-    {"tan", "t"},
-    {"sec", "se"},
-    {"csc", "cs"},
-    {"cot", "ct"}
-};
+std::shared_ptr<Arg> Arg::GetFraction(std::string_view parent, int divisor)
+{
+    return Context::GetCurrent().GetFraction(parent, divisor);
+}
 
 
-bool IsTrigName(const std::string &name)
+std::shared_ptr<Arg> Arg::GetParent() const
 {
-    if (name.size() != 3)
-    {
-        return false;
-    }
+    return this->parent_;
+}
 
-    auto found =
-        std::find(
-            std::begin(trigNames),
-            std::end(trigNames),
-            name.substr(0, 3));
 
-    return (found != std::end(trigNames));
+int Arg::GetDivisor() const
+{
+    return this->divisor_;
 }
 
 
-double GetTrigValue(const std::string &name, double argValue)
+uint32_t Arg::GetId() const
 {
-    // isTrig_
-    if (name == "sin")
+    return this->id_;
+}
+
+
+uint64_t Arg::GetSortKey() const
+{
+    return this->sortKey_;
+}
+
+
+uint64_t Arg::GetVersion() const
+{
+    if (this->parent_)
     {
-        return std::sin(argValue);
+        return this->parent_->GetVersion();
     }
-    else if (name == "cos")
+
+    return this->version_;
+}
+
+
+bool IsTrigName(const std::string &name)
+{
+    return name.size() == 3 && FindTrig(name) != Trig::none;
+}
+
+
+double ExactTrig::GetValue() const
+{
+    return this->sign * std::sqrt(
+        static_cast<double>(this->numerator)
+            / static_cast<double>(this->denominator));
+}
+
+
+static ExactTrig MakeExactTrig(int sign, int numerator, int denominator)
+{
+    if (numerator == 0)
     {
-        return std::cos(argValue);
+        return {0, 0, 1};
     }
-    else if (name == "tan")
+
+    int divisor = std::gcd(numerator, denominator);
+
+    return {sign, numerator / divisor, denominator / divisor};
+}
+
+
+// The exact cosine of k * π / 12, or nothing when it needs nested radicals.
+static std::optional<ExactTrig> GetExactCosine(int k)
+{
+    // The square of the cosine, indexed by k modulo 12.
+    // Odd multiples of π/12 are not exact in this form.
+    static const std::optional<std::pair<int, int>> squares[12]{
+        {{1, 1}},
+        {},
+        {{3, 4}},
+        {{1, 2}},
+        {{1, 4}},
+        {},
+        {{0, 1}},
+        {},
+        {{1, 4}},
+        {{1, 2}},
+        {{3, 4}},
+        {}};
+
+    k = ((k % 24) + 24) % 24;
+
+    const auto &square = squares[k % 12];
+
+    if (!square)
     {
-        return std::tan(argValue);
+        return {};
     }
-    else if (name == "sec")
+
+    int sign = (k > 6 && k < 18) ? -1 : 1;
+
+    return MakeExactTrig(sign, square->first, square->second);
+}
+
+
+// numerator / denominator, or nothing at a pole.
+static std::optional<ExactTrig> Divide(
+    const ExactTrig &numerator,
+    const ExactTrig &denominator)
+{
+    if (denominator.sign == 0)
     {
-        return 1.0 / std::cos(argValue);
+        return {};
     }
-    else if (name == "csc")
+
+    return MakeExactTrig(
+        numerator.sign * denominator.sign,
+        numerator.numerator * denominator.denominator,
+        numerator.denominator * denominator.numerator);
+}
+
+
+std::optional<ExactTrig> GetExactTrigValue(
+    Trig function,
+    const PiMultiple &angle)
+{
+    // Measure the angle in multiples of π/12.
+    if ((12 * angle.numerator) % angle.denominator != 0)
     {
-        return 1.0 / std::sin(argValue);
+        return {};
     }
-    else if (name == "cot")
+
+    int k = (12 * angle.numerator) / angle.denominator;
+
+    auto cosine = GetExactCosine(k);
+    auto sine = GetExactCosine(6 - k);
+
+    if (!cosine || !sine)
     {
-        return 1.0 / std::tan(argValue);
+        return {};
     }
-    else
+
+    static const ExactTrig one{1, 1, 1};
+
+    switch (function)
     {
-        throw std::logic_error("Not a supported trig function");
+        case Trig::sin:
+            return sine;
+
+        case Trig::cos:
+            return cosine;
+
+        case Trig::tan:
+            return Divide(*sine, *cosine);
+
+        case Trig::sec:
+            return Divide(one, *cosine);
+
+        case Trig::csc:
+            return Divide(one, *sine);
+
+        case Trig::cot:
+            return Divide(*cosine, *sine);
+
+        default:
+            throw std::logic_error("Not a supported trig function");
     }
 }
 
 
 SymbolName::SymbolName(const std::string &name)
     :
-    name_{},
     arg_{},
-    isTrig_(IsTrigName(name))
+    function_(Trig::none)
 {
-    if (this->isTrig_)
+    if (IsTrigName(name))
     {
-        this->name_ = name.substr(0, 3);
+        this->function_ = FindTrig(name);
         auto arg = jive::strings::Trim(name.substr(3));
         this->arg_ = Arg::Get(jive::strings::Trim(arg, "()"));
     }
@@ -382,21 +665,33 @@ SymbolName::SymbolName(const std::string &name)
 
 SymbolName::SymbolName(const std::string &name, const std::string &arg)
     :
-    name_{},
     arg_{},
-    isTrig_(IsTrigName(name))
+    function_(Trig::none)
 {
-    if (!this->isTrig_)
+    if (!IsTrigName(name))
     {
         throw std::runtime_error(
             "This constructor is only for trig functions.");
     }
 
-    this->name_ = name;
+    this->function_ = FindTrig(name);
     this->arg_ = Arg::Get(arg);
 }
 
 
+SymbolName::SymbolName(Trig function, const std::shared_ptr<Arg> &arg)
+    :
+    arg_(arg),
+    function_(function)
+{
+    if (function == Trig::none)
+    {
+        throw std::runtime_error(
+            "This constructor is only for trig functions.");
+    }
+}
+
+
 std::ostream & SymbolName::ToStream(
     std::ostream &output,
     const Symbol &power) const
@@ -410,17 +705,11 @@ std::ostream & SymbolName::ToStream(
         return output << "1";
     }
 
-    if (this->isTrig_)
+    if (this->IsTrig())
     {
-        std::string name;
-        if (settings::printCompact)
-        {
-            name = shortTrigNames.at(this->name_);
-        }
-        else
-        {
-            name = this->name_;
-        }
+        const auto &info = GetTrigInfo(this->function_);
+
+        auto name = (settings::printCompact) ? info.shortName : info.name;
 
         if (*powerValue != 1)
         {
@@ -439,6 +728,31 @@ std::ostream & SymbolName::ToStream(
 }
 
 
+const std::optional<ExactTrig> & SymbolName::GetExactValue() const
+{
+    return this->GetDerived_().exact;
+}
+
+
+const Arg::Derived_ & SymbolName::GetDerived_() const
+{
+    return this->arg_->GetDerived_(this->function_);
+}
+
+
+std::optional<double> SymbolName::GetValue_(const Frame &frame) const
+{
+    auto value = frame.GetValue(*this->arg_);
+
+    if (!value || !this->IsTrig())
+    {
+        return value;
+    }
+
+    return GetTrigValue(this->function_, *value);
+}
+
+
 std::string SymbolName::GetName() const
 {
     std::ostringstream output;
@@ -450,7 +764,7 @@ std::string SymbolName::GetName() const
 
 bool SymbolName::operator==(const SymbolName &other) const
 {
-    return this->name_ == other.name_ && this->arg_.get() == other.arg_.get();
+    return this->function_ == other.function_ && this->arg_ == other.arg_;
 }
 
 
@@ -462,22 +776,27 @@ bool SymbolName::operator!=(const SymbolName &other) const
 
 bool SymbolName::operator<(const SymbolName &other) const
 {
-    if (this->isTrig_)
+    return CompareArgs(*this, other) < 0;
+}
+
+
+int SymbolName::CompareArgs(const SymbolName &left, const SymbolName &right)
+{
+    if (left.arg_ == right.arg_)
     {
-        if (greek::IsGreek(*this->arg_) && greek::IsGreek(*other.arg_))
-        {
-            return greek::sortOrder.at(*this->arg_)
-                < greek::sortOrder.at(*other.arg_);
-        }
-        else
-        {
-            return *this->arg_ < *other.arg_;
-        }
+        return 0;
     }
-    
-    assert(this->name_.empty());
 
-    return *this->arg_ < *other.arg_;
+    auto leftKey = left.arg_->sortKey_;
+    auto rightKey = right.arg_->sortKey_;
+
+    if (leftKey != rightKey)
+    {
+        return (leftKey < rightKey) ? -1 : 1;
+    }
+
+    // The names share their first eight bytes.
+    return left.arg_->compare(*right.arg_);
 }
 
 
@@ -520,8 +839,33 @@ S::S(const std::string &name, const std::string &arg)
 }
 
 
+// A trig function of an exact angle is replaced by its exact value.
+static S Collapse(const S &symbol)
+{
+    if (!symbol->IsNamed())
+    {
+        return symbol;
+    }
+
+    auto named = dynamic_cast<const Named *>(symbol.get());
+    assert(named);
+
+    auto exact = named->GetExactValue();
+
+    if (!exact)
+    {
+        return symbol;
+    }
+
+    return S(std::make_shared<Value>(*exact));
+}
+
+
 S operator+(S left, S right)
 {
+    left = Collapse(left);
+    right = Collapse(right);
+
     if (left->IsValue())
     {
         auto valuePointer = dynamic_cast<Value *>(left.get());
@@ -550,6 +894,9 @@ S operator+(S left, S right)
 
 S operator-(S left, S right)
 {
+    left = Collapse(left);
+    right = Collapse(right);
+
     if (left->IsValue())
     {
         auto valuePointer = dynamic_cast<Value *>(left.get());
@@ -582,12 +929,18 @@ S operator-(S left, S right)
 
 S operator*(S left, S right)
 {
+    left = Collapse(left);
+    right = Collapse(right);
+
     return left->operator*(right);
 }
 
 
 S operator/(S left, S right)
 {
+    left = Collapse(left);
+    right = Collapse(right);
+
     return left->operator/(right);
 }
 
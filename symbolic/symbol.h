@@ -15,7 +15,12 @@
 #include <ostream>
 #include <sstream>
 #include <memory>
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string_view>
 #include <iostream>
+#include "symbolic/trig.h"
 
 enum class Op
 {
@@ -82,6 +87,9 @@ public:
     virtual bool PowersAdd(Pointer other) const = 0;
     virtual bool Equals(Pointer other) const = 0;
 
+    // Symbols that are Equals have the same hash.
+    virtual size_t Hash() const = 0;
+
     virtual bool SortProduct(Pointer) const
     {
         return false;
@@ -99,6 +107,21 @@ public:
 bool operator<(typename Symbol::Pointer left, typename Symbol::Pointer right);
 
 
+inline size_t HashCombine(size_t seed, size_t value)
+{
+    return seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+}
+
+
+// The top bits of a Fibonacci hash of value, which depend on all of its
+// bits. Hash tables bucket by the low bits of a hash, so use these to
+// select a shard or partition, which keeps the two choices independent.
+inline size_t MixHash(size_t value, size_t bits)
+{
+    return (value * 0x9e3779b97f4a7c15ULL) >> (64 - bits);
+}
+
+
 std::ostream & operator<<(
     std::ostream &output,
     typename Symbol::Pointer symbol);
@@ -135,12 +158,64 @@ std::ostream & operator<<(std::ostream &output, const Op &op);
 bool IsTrigName(const std::string &name);
 
 
+// The angle numerator * π / denominator, in lowest terms with a positive
+// denominator.
+struct PiMultiple
+{
+    int numerator;
+    int denominator;
+};
+
+
+// The exact value sign * sqrt(numerator / denominator) of a trig function.
+struct ExactTrig
+{
+    int sign;
+    int numerator;
+    int denominator;
+
+    double GetValue() const;
+};
+
+
+// Trig functions of multiples of π/6 and π/4 have exact values.
+// Returns nothing for other angles, and at poles.
+std::optional<ExactTrig> GetExactTrigValue(
+    Trig function,
+    const PiMultiple &angle);
+
+
+class Context;
+class Frame;
+class SymbolName;
+
+
 class Arg: public std::string
 {
 private:
-    Arg(const std::string &name);
+    friend class Context;
+    friend class SymbolName;
+
+    Arg(const std::string &name, uint32_t id);
+
+    Arg(
+        const std::string &name,
+        uint32_t id,
+        const std::shared_ptr<Arg> &parent,
+        int divisor);
+
+    // The constructors are private, so std::make_shared cannot be used.
+    static std::shared_ptr<Arg> CreateShared_(
+        const std::string &name,
+        uint32_t id);
 
-    static std::shared_ptr<Arg> CreateShared_(const std::string &name);
+    static std::shared_ptr<Arg> CreateShared_(
+        const std::string &name,
+        uint32_t id,
+        const std::shared_ptr<Arg> &parent,
+        int divisor);
+
+    void InitializeDerived_();
 
 public:
     void ClearValue();
@@ -149,15 +224,64 @@ public:
 
     std::optional<double> GetValue() const;
 
-    static std::shared_ptr<Arg> Get(const std::string &name);
+    // Sets the value to the exact angle numerator * π / denominator.
+    // Trig functions of common angles then have exact values.
+    void SetPiMultiple(int numerator, int denominator);
+
+    // The exact angle, when one was set.
+    std::optional<PiMultiple> GetPiMultiple() const;
+
+    // Gets the argument from the current Context.
+    static std::shared_ptr<Arg> Get(std::string_view name);
+
+    // Gets the argument parent/divisor, such as the half angle "α/2".
+    // Its value follows the parent, and setting it directly throws.
+    static std::shared_ptr<Arg> GetFraction(
+        std::string_view parent,
+        int divisor);
+
+    // The argument this one is a fraction of, or nullptr.
+    std::shared_ptr<Arg> GetParent() const;
+
+    int GetDivisor() const;
+
+    // Dense and unique within the Context that owns this argument.
+    uint32_t GetId() const;
+
+    // Orders arguments by name, with Greek letters in alphabetical order
+    // after the Latin names. Arguments with the same key compare by name.
+    uint64_t GetSortKey() const;
+
+    // Changes whenever the value changes. A fractional argument has the
+    // version of its parent.
+    uint64_t GetVersion() const;
 
 
 private:
-    std::optional<double> value_;
-};
+    // Values derived from the argument for each SymbolName function,
+    // valid while the version is unchanged. Like the values, they are not
+    // synchronized.
+    struct Derived_
+    {
+        uint64_t version;
+        std::optional<double> value;
+        std::optional<ExactTrig> exact;
+    };
+
+    const Derived_ & GetDerived_(Trig function) const;
 
+    // Brings the derived values of every function up to date.
+    void UpdateDerived_() const;
 
-double GetTrigValue(const std::string &name, double arg);
+    std::optional<double> value_;
+    std::optional<PiMultiple> piMultiple_;
+    std::shared_ptr<Arg> parent_;
+    int divisor_;
+    uint32_t id_;
+    uint64_t sortKey_;
+    uint64_t version_;
+    mutable std::array<Derived_, std::size(trigTable)> derived_;
+};
 
 
 class SymbolName
@@ -167,6 +291,8 @@ public:
 
     SymbolName(const std::string &name, const std::string &arg);
 
+    SymbolName(Trig function, const std::shared_ptr<Arg> &arg);
+
     std::ostream & ToStream(std::ostream &output, const Symbol &power) const;
 
     std::string GetName() const;
@@ -179,49 +305,82 @@ public:
 
     bool IsTrig() const
     {
-        return this->isTrig_;
+        return this->function_ != Trig::none;
     }
 
     template<typename T>
     std::optional<T> GetValue() const
     {
-        auto argValue = this->arg_->GetValue();
+        const auto &value = this->GetDerived_().value;
 
-        if (!argValue)
+        if (!value)
         {
             return {};
         }
 
-        double value;
-
-        if (!this->isTrig_)
+        if constexpr (std::is_integral_v<T>)
         {
-            value = *argValue;
+            return static_cast<T>(std::round(*value));
         }
         else
         {
-            value = GetTrigValue(this->name_, *argValue);
+            return static_cast<T>(*value);
+        }
+    }
+
+    // The value with the arguments in frame, ignoring the values set on
+    // the Args.
+    template<typename T>
+    std::optional<T> GetValue(const Frame &frame) const
+    {
+        auto value = this->GetValue_(frame);
+
+        if (!value)
+        {
+            return {};
         }
 
         if constexpr (std::is_integral_v<T>)
         {
-            return static_cast<T>(std::round(value));
+            return static_cast<T>(std::round(*value));
         }
         else
         {
-            return static_cast<T>(value);
+            return static_cast<T>(*value);
         }
     }
 
-    std::shared_ptr<Arg> GetArg()
+    // The exact value of a trig function of an exact angle.
+    const std::optional<ExactTrig> & GetExactValue() const;
+
+    const std::shared_ptr<Arg> & GetArg() const
     {
         return this->arg_;
     }
 
+    uint32_t GetArgId() const
+    {
+        return this->arg_->GetId();
+    }
+
+    // The trig function, or Trig::none for a plain symbol.
+    Trig GetFunction() const
+    {
+        return this->function_;
+    }
+
+    // Orders by argument, using the precomputed sort keys.
+    static int CompareArgs(const SymbolName &left, const SymbolName &right);
+
 private:
-    std::string name_;
+    const Arg::Derived_ & GetDerived_() const;
+
+    std::optional<double> GetValue_(const Frame &frame) const;
+
+    // Shared with its Context, so that symbols may outlive the Context.
+    // Comparisons use the id and sort key of the Arg, not its name.
     std::shared_ptr<Arg> arg_;
-    bool isTrig_;
+    Trig function_;
 };
 
 
@@ -15,5 +15,20 @@
 
 #include <symbolic/symbol.h>
 #include <symbolic/matrix.h>
+#include <symbolic/sparse_matrix.h>
+#include <symbolic/polynomial.h>
+#include <symbolic/power_series.h>
+#include <symbolic/product_graph.h>
+#include <symbolic/specialize.h>
+#include <symbolic/quaternion.h>
+#include <symbolic/compiled.h>
+#include <symbolic/context.h>
+#include <symbolic/frame.h>
+#include <symbolic/kinematics.h>
+#include <symbolic/derivative.h>
+#include <symbolic/interner.h>
+#include <symbolic/concurrent_interner.h>
+#include <symbolic/thread_pool.h>
+#include <symbolic/parallel_sum.h>
 #include <symbolic/greek.h>
 #include <symbolic/settings.h>
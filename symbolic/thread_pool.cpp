@@ -0,0 +1,286 @@
+/**
+  * @file thread_pool.cpp
+  *
+  * @brief Implements the work-stealing thread pool.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#include "symbolic/thread_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include "symbolic/context.h"
+
+
+// Set while this thread is running tasks, so that nested calls to ForEach
+// do not wait on the threads they are running on.
+static thread_local bool isInTask = false;
+
+
+class ThreadPool::Job_
+{
+public:
+    Job_(
+        size_t count,
+        size_t participantCount,
+        const std::function<void(size_t)> &task,
+        Context &context)
+        :
+        task_(task),
+        context_(context),
+        queues_(participantCount),
+        isFailed_(false),
+        errorMutex_(),
+        error_()
+    {
+        // Each participant starts with a contiguous block.
+        for (size_t i = 0; i < participantCount; ++i)
+        {
+            this->queues_[i].first = i * count / participantCount;
+            this->queues_[i].last = (i + 1) * count / participantCount;
+        }
+    }
+
+    void Run(size_t participant)
+    {
+        Context::Scope scope(this->context_);
+        bool wasInTask = isInTask;
+        isInTask = true;
+
+        size_t index;
+
+        while (this->Take_(participant, index))
+        {
+            if (this->isFailed_)
+            {
+                continue;
+            }
+
+            try
+            {
+                this->task_(index);
+            }
+            catch (...)
+            {
+                std::lock_guard lock(this->errorMutex_);
+
+                if (!this->error_)
+                {
+                    this->error_ = std::current_exception();
+                }
+
+                this->isFailed_ = true;
+            }
+        }
+
+        isInTask = wasInTask;
+    }
+
+    void Rethrow() const
+    {
+        if (this->error_)
+        {
+            std::rethrow_exception(this->error_);
+        }
+    }
+
+private:
+    // Takes from the front of its own block, then from the back of the
+    // others.
+    bool Take_(size_t participant, size_t &index)
+    {
+        size_t count = this->queues_.size();
+
+        for (size_t offset = 0; offset < count; ++offset)
+        {
+            auto &queue = this->queues_[(participant + offset) % count];
+            std::lock_guard lock(queue.mutex);
+
+            if (queue.first == queue.last)
+            {
+                continue;
+            }
+
+            if (offset == 0)
+            {
+                index = queue.first++;
+            }
+            else
+            {
+                index = --queue.last;
+            }
+
+            return true;
+        }
+
+        return false;
+    }
+
+    // The indices [first, last) not yet taken from one block.
+    struct alignas(64) Queue_
+    {
+        std::mutex mutex;
+        size_t first = 0;
+        size_t last = 0;
+    };
+
+    const std::function<void(size_t)> &task_;
+    Context &context_;
+    std::vector<Queue_> queues_;
+    std::atomic<bool> isFailed_;
+    std::mutex errorMutex_;
+    std::exception_ptr error_;
+};
+
+
+ThreadPool::ThreadPool(size_t threadCount)
+    :
+    threads_(),
+    forEachMutex_(),
+    mutex_(),
+    wake_(),
+    done_(),
+    job_(),
+    generation_(0),
+    activeCount_(0),
+    isStopping_(false)
+{
+    this->threads_.reserve(threadCount);
+
+    for (size_t i = 0; i < threadCount; ++i)
+    {
+        // The calling thread of ForEach is participant 0.
+        this->threads_.emplace_back(&ThreadPool::Run_, this, i + 1);
+    }
+}
+
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard lock(this->mutex_);
+        this->isStopping_ = true;
+    }
+
+    this->wake_.notify_all();
+
+    for (auto &thread: this->threads_)
+    {
+        thread.join();
+    }
+}
+
+
+size_t ThreadPool::GetThreadCount() const
+{
+    return this->threads_.size();
+}
+
+
+void ThreadPool::ForEach(
+    size_t count,
+    const std::function<void(size_t)> &task)
+{
+    if (this->threads_.empty() || isInTask || count < 2)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            task(i);
+        }
+
+        return;
+    }
+
+    std::lock_guard forEachLock(this->forEachMutex_);
+
+    auto &context = Context::GetCurrent();
+    context.UpdateDerived();
+
+    auto job = std::make_shared<Job_>(
+        count,
+        this->threads_.size() + 1,
+        task,
+        context);
+
+    {
+        std::lock_guard lock(this->mutex_);
+        this->job_ = job;
+        this->activeCount_ = this->threads_.size();
+        ++this->generation_;
+    }
+
+    this->wake_.notify_all();
+
+    job->Run(0);
+
+    {
+        std::unique_lock lock(this->mutex_);
+
+        this->done_.wait(
+            lock,
+            [this]()
+            {
+                return this->activeCount_ == 0;
+            });
+
+        this->job_.reset();
+    }
+
+    job->Rethrow();
+}
+
+
+ThreadPool & ThreadPool::GetDefault()
+{
+    static ThreadPool pool(
+        std::max(std::thread::hardware_concurrency(), 1u) - 1);
+
+    return pool;
+}
+
+
+void ThreadPool::Run_(size_t participant)
+{
+    size_t generation = 0;
+
+    while (true)
+    {
+        std::shared_ptr<Job_> job;
+
+        {
+            std::unique_lock lock(this->mutex_);
+
+            this->wake_.wait(
+                lock,
+                [this, generation]()
+                {
+                    return this->isStopping_
+                        || this->generation_ != generation;
+                });
+
+            if (this->isStopping_)
+            {
+                return;
+            }
+
+            generation = this->generation_;
+            job = this->job_;
+        }
+
+        job->Run(participant);
+
+        {
+            std::lock_guard lock(this->mutex_);
+
+            if (--this->activeCount_ == 0)
+            {
+                this->done_.notify_all();
+            }
+        }
+    }
+}
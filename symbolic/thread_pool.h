@@ -0,0 +1,81 @@
+/**
+  * @file thread_pool.h
+  *
+  * @brief Runs independent symbolic tasks on several threads.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+/**
+  * ForEach calls a task once for every index, on the threads of the pool
+  * and the calling thread. Each thread starts with a contiguous block of
+  * the indices, and a thread that runs out steals from the far end of
+  * another thread's block, so uneven task costs still keep every thread
+  * busy.
+  *
+  * Tasks run in the Context of the calling thread. Before they start, the
+  * derived values of its arguments are brought up to date (see
+  * Context::UpdateDerived), so that tasks may read argument values freely.
+  * Tasks must not create arguments or change their values.
+  *
+  * Which thread runs an index is not deterministic, so tasks should only
+  * write results to their own index. Results are then the same for any
+  * count of threads.
+**/
+class ThreadPool
+{
+public:
+    // A pool of threadCount threads in addition to the calling thread.
+    // A pool without threads runs every task on the calling thread.
+    explicit ThreadPool(size_t threadCount);
+
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+
+    ThreadPool & operator=(const ThreadPool &) = delete;
+
+    size_t GetThreadCount() const;
+
+    // Returns when every task has finished. The first exception thrown by
+    // a task is rethrown here, and the tasks not yet started are skipped.
+    //
+    // Called from inside a task, ForEach runs the tasks on the calling
+    // thread instead of waiting on the pool.
+    void ForEach(size_t count, const std::function<void(size_t)> &task);
+
+    // A shared pool with one thread for each additional hardware thread.
+    static ThreadPool & GetDefault();
+
+private:
+    class Job_;
+
+    void Run_(size_t participant);
+
+    std::vector<std::thread> threads_;
+
+    // Serializes ForEach calls from different threads.
+    std::mutex forEachMutex_;
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    std::shared_ptr<Job_> job_;
+    size_t generation_;
+    size_t activeCount_;
+    bool isStopping_;
+};
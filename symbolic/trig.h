@@ -0,0 +1,130 @@
+/**
+  * @file trig.h
+  *
+  * @brief The supported trig functions and their properties.
+  *
+  * @author Jive Helix (jivehelix@gmail.com)
+  * @date 18 Oct 2026
+  * @copyright Jive Helix
+  * Licensed under the MIT license. See LICENSE file.
+**/
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <string_view>
+
+
+// A trig function, or none for a plain symbol.
+enum class Trig: uint8_t
+{
+    none,
+    sin,
+    cos,
+    tan,
+    sec,
+    csc,
+    cot
+};
+
+
+struct TrigInfo
+{
+    std::string_view name;
+
+    // Printed with settings::printCompact.
+    std::string_view shortName;
+
+    double (*evaluate)(double);
+    double (*derivative)(double);
+
+    // The symbolic derivative is derivativeSign times the product of the
+    // derivativeFactors of the same argument, skipping none.
+    int derivativeSign;
+    Trig derivativeFactors[2];
+};
+
+
+// Indexed by Trig.
+inline constexpr TrigInfo trigTable[] =
+{
+    {
+        "", "",
+        [](double x) { return x; },
+        [](double) { return 1.0; },
+        1, {Trig::none, Trig::none}
+    },
+    {
+        "sin", "s",
+        [](double x) { return std::sin(x); },
+        [](double x) { return std::cos(x); },
+        1, {Trig::cos, Trig::none}
+    },
+    {
+        "cos", "c",
+        [](double x) { return std::cos(x); },
+        [](double x) { return -std::sin(x); },
+        -1, {Trig::sin, Trig::none}
+    },
+    {
+        "tan", "t",
+        [](double x) { return std::tan(x); },
+        [](double x) { return 1.0 / (std::cos(x) * std::cos(x)); },
+        1, {Trig::sec, Trig::sec}
+    },
+    {
+        "sec", "se",
+        [](double x) { return 1.0 / std::cos(x); },
+        [](double x) { return std::tan(x) / std::cos(x); },
+        1, {Trig::sec, Trig::tan}
+    },
+    {
+        "csc", "cs",
+        [](double x) { return 1.0 / std::sin(x); },
+        [](double x) { return -1.0 / (std::sin(x) * std::tan(x)); },
+        -1, {Trig::csc, Trig::cot}
+    },
+    {
+        "cot", "ct",
+        [](double x) { return 1.0 / std::tan(x); },
+        [](double x) { return -1.0 / (std::sin(x) * std::sin(x)); },
+        -1, {Trig::csc, Trig::csc}
+    }
+};
+
+
+constexpr const TrigInfo & GetTrigInfo(Trig function)
+{
+    return trigTable[static_cast<size_t>(function)];
+}
+
+
+// The function named by the first three characters of name, or none.
+constexpr Trig FindTrig(std::string_view name)
+{
+    auto prefix = name.substr(0, 3);
+
+    for (size_t i = 1; i < std::size(trigTable); ++i)
+    {
+        if (trigTable[i].name == prefix)
+        {
+            return static_cast<Trig>(i);
+        }
+    }
+
+    return Trig::none;
+}
+
+
+inline double GetTrigValue(Trig function, double argValue)
+{
+    if (function == Trig::none)
+    {
+        throw std::logic_error("Not a supported trig function");
+    }
+
+    return GetTrigInfo(function).evaluate(argValue);
+}
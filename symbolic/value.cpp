@@ -12,12 +12,55 @@
 #include "value.h"
 
 #include <fmt/core.h>
+#include <stdexcept>
 #include "expression.h"
 #include "named.h"
 
 
 using Pointer = typename Symbol::Pointer;
 
+
+// Exact values must never wrap around, so every product and sum of
+// numerators and divisors is checked.
+static int CheckedAdd(int left, int right)
+{
+    int result;
+
+    if (__builtin_add_overflow(left, right, &result))
+    {
+        throw std::overflow_error("Value overflow");
+    }
+
+    return result;
+}
+
+
+static int CheckedSubtract(int left, int right)
+{
+    int result;
+
+    if (__builtin_sub_overflow(left, right, &result))
+    {
+        throw std::overflow_error("Value overflow");
+    }
+
+    return result;
+}
+
+
+static int CheckedMultiply(int left, int right)
+{
+    int result;
+
+    if (__builtin_mul_overflow(left, right, &result))
+    {
+        throw std::overflow_error("Value overflow");
+    }
+
+    return result;
+}
+
+
 Value::Value(int value)
     :
     value_(value),
@@ -75,7 +118,8 @@ int Value::GreatestCommonDivisor(int left, int right)
 {
     if (right == 0)
     {
-        return left;
+        // The divisor must keep its sign when it is reduced.
+        return std::abs(left);
     }
 
     return GreatestCommonDivisor(right, left % right);
@@ -161,8 +205,8 @@ Pointer Value::MultiplyScalar(Pointer scalar) const
     }
 
     return std::make_shared<Value>(
-        this->value_ * asValue->value_,
-        this->divisor_ * asValue->divisor_);
+        CheckedMultiply(this->value_, asValue->value_),
+        CheckedMultiply(this->divisor_, asValue->divisor_));
 }
 
 
@@ -230,14 +274,14 @@ Pointer Value::operator+(const Value &other) const
     if (this->divisor_ == other.divisor_)
     {
         return std::make_shared<Value>(
-            this->value_ + other.value_,
+            CheckedAdd(this->value_, other.value_),
             this->divisor_);
     }
 
-    int left = this->value_ * other.divisor_;
-    int right = other.value_ * this->divisor_;
-    int result = left + right;
-    int divisor = this->divisor_ * other.divisor_;
+    int left = CheckedMultiply(this->value_, other.divisor_);
+    int right = CheckedMultiply(other.value_, this->divisor_);
+    int result = CheckedAdd(left, right);
+    int divisor = CheckedMultiply(this->divisor_, other.divisor_);
 
     return std::make_shared<Value>(
         result,
@@ -257,14 +301,14 @@ Pointer Value::operator-(const Value &other) const
     if (this->divisor_ == other.divisor_)
     {
         return std::make_shared<Value>(
-            this->value_ - other.value_,
+            CheckedSubtract(this->value_, other.value_),
             this->divisor_);
     }
 
-    int left = this->value_ * other.divisor_;
-    int right = other.value_ * this->divisor_;
-    int result = left - right;
-    int divisor = this->divisor_ * other.divisor_;
+    int left = CheckedMultiply(this->value_, other.divisor_);
+    int right = CheckedMultiply(other.value_, this->divisor_);
+    int result = CheckedSubtract(left, right);
+    int divisor = CheckedMultiply(this->divisor_, other.divisor_);
 
     return std::make_shared<Value>(
         result,
@@ -282,8 +326,8 @@ Pointer Value::operator*(const Value &other) const
     }
 
     return std::make_shared<Value>(
-        this->value_ * other.value_,
-        this->divisor_ * other.divisor_,
+        CheckedMultiply(this->value_, other.value_),
+        CheckedMultiply(this->divisor_, other.divisor_),
         this->powerValue_,
         this->powerDivisor_);
 }
@@ -297,13 +341,77 @@ Pointer Value::operator/(const Value &other) const
     }
 
     return std::make_shared<Value>(
-        this->value_ * other.divisor_,
-        this->divisor_ * other.value_,
+        CheckedMultiply(this->value_, other.divisor_),
+        CheckedMultiply(this->divisor_, other.value_),
         this->powerValue_,
         this->powerDivisor_);
 }
 
 
+Value & Value::operator+=(const Value &other)
+{
+    if (this->HasPower() || other.HasPower())
+    {
+        throw std::runtime_error("Cannot add values with powers.");
+    }
+
+    *this = Value(
+        CheckedAdd(
+            CheckedMultiply(this->value_, other.divisor_),
+            CheckedMultiply(other.value_, this->divisor_)),
+        CheckedMultiply(this->divisor_, other.divisor_));
+
+    return *this;
+}
+
+
+Value & Value::operator-=(const Value &other)
+{
+    if (this->HasPower() || other.HasPower())
+    {
+        throw std::runtime_error("Cannot subtract values with powers.");
+    }
+
+    *this = Value(
+        CheckedSubtract(
+            CheckedMultiply(this->value_, other.divisor_),
+            CheckedMultiply(other.value_, this->divisor_)),
+        CheckedMultiply(this->divisor_, other.divisor_));
+
+    return *this;
+}
+
+
+Value & Value::operator*=(const Value &other)
+{
+    if (this->HasPower() || other.HasPower())
+    {
+        throw std::runtime_error("Cannot multiply values with powers.");
+    }
+
+    *this = Value(
+        CheckedMultiply(this->value_, other.value_),
+        CheckedMultiply(this->divisor_, other.divisor_));
+
+    return *this;
+}
+
+
+Value & Value::operator/=(const Value &other)
+{
+    if (this->HasPower() || other.HasPower())
+    {
+        throw std::runtime_error("Cannot divide values with powers.");
+    }
+
+    *this = Value(
+        CheckedMultiply(this->value_, other.divisor_),
+        CheckedMultiply(this->divisor_, other.value_));
+
+    return *this;
+}
+
+
 Pointer Value::operator+(Pointer other) const
 {
     Value *otherValue = dynamic_cast<Value *>(other.get());
@@ -346,6 +454,12 @@ Pointer Value::operator*(Pointer other) const
         return otherNamed->operator*(*this);
     }
 
+    if (!this->HasPower())
+    {
+        // Like Expression::operator*(Value), scale the expression.
+        return other->MultiplyScalar(std::make_shared<Value>(*this));
+    }
+
     return Expression::Multiply(std::make_shared<Value>(*this), other);
 }
 
@@ -398,7 +512,7 @@ Pointer Value::Copy() const
 
 Pointer Value::Invert() const
 {
-    if (this-value_ == 0)
+    if (this->value_ == 0)
     {
         throw std::runtime_error("Divide by zero");
     }
@@ -446,6 +560,16 @@ bool Value::Equals(Pointer other) const
 }
 
 
+size_t Value::Hash() const
+{
+    size_t result = std::hash<int>()(this->value_);
+    result = HashCombine(result, std::hash<int>()(this->divisor_));
+    result = HashCombine(result, std::hash<int>()(this->powerValue_));
+
+    return HashCombine(result, std::hash<int>()(this->powerDivisor_));
+}
+
+
 Value Value::GetPower_() const
 {
     return Value(this->powerValue_, this->powerDivisor_);
@@ -56,6 +56,15 @@ public:
 
     Pointer operator/(const Value &other) const;
 
+    // In-place arithmetic for values without powers.
+    Value & operator+=(const Value &other);
+
+    Value & operator-=(const Value &other);
+
+    Value & operator*=(const Value &other);
+
+    Value & operator/=(const Value &other);
+
     Pointer operator+(Pointer other) const override;
 
     Pointer operator-(Pointer other) const override;
@@ -77,6 +86,8 @@ public:
 
     bool Equals(Pointer other) const override;
 
+    size_t Hash() const override;
+
     bool HasPower() const;
 
     bool IsOne() const override;